@@ -0,0 +1,148 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "tradier/market.hpp"
+#include "tradier/simd/chain_analytics.hpp"
+
+using namespace tradier;
+namespace chain = tradier::simd::chain;
+
+namespace {
+
+OptionChainColumns makeChain(size_t rows) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> price(0.05, 30.0);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::uniform_int_distribution<int32_t> interest(0, 50000);
+    
+    OptionChainColumns columns;
+    columns.reserve(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        double bid = price(rng);
+        columns.strike.push_back(100.0 + static_cast<double>(i) * 0.5);
+        columns.bid.push_back(bid);
+        columns.ask.push_back(bid * 1.03);
+        columns.delta.push_back(unit(rng));
+        columns.gamma.push_back(std::abs(unit(rng)) * 0.05);
+        columns.openInterest.push_back(interest(rng));
+        columns.contractSize.push_back(100);
+    }
+    return columns;
+}
+
+void finish(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(simd::isa_name(simd::active_isa()));
+}
+
+}
+
+// Each kernel runs through the library's dispatch (the best variant this CPU
+// supports, see simd::active_isa) and through the scalar variant directly.
+
+static void BM_ChainMidPrice(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    std::vector<double> out(columns.size());
+    for (auto _ : state) {
+        chain::mid_price(columns, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainMidPrice)->Arg(2000)->Arg(100000);
+
+static void BM_ChainMidPrice_Scalar(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    std::vector<double> out(columns.size());
+    for (auto _ : state) {
+        chain::mid_price_impl::scalar(columns.bid.data(), columns.ask.data(), out.data(), columns.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainMidPrice_Scalar)->Arg(2000)->Arg(100000);
+
+static void BM_ChainRelativeSpread(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    std::vector<double> out(columns.size());
+    for (auto _ : state) {
+        chain::relative_spread(columns, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainRelativeSpread)->Arg(2000)->Arg(100000);
+
+static void BM_ChainRelativeSpread_Scalar(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    std::vector<double> out(columns.size());
+    for (auto _ : state) {
+        chain::relative_spread_impl::scalar(columns.bid.data(), columns.ask.data(), out.data(), columns.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainRelativeSpread_Scalar)->Arg(2000)->Arg(100000);
+
+static void BM_ChainMoneyness(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    std::vector<double> out(columns.size());
+    for (auto _ : state) {
+        chain::moneyness(columns, 450.0, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainMoneyness)->Arg(2000)->Arg(100000);
+
+static void BM_ChainGreekExposure(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chain::greek_exposure_sum(columns, 450.0));
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainGreekExposure)->Arg(2000)->Arg(100000);
+
+static void BM_ChainGreekExposure_Scalar(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chain::greek_exposure_impl::scalar(columns.delta.data(), columns.gamma.data(),
+            columns.openInterest.data(), columns.contractSize.data(), 450.0, columns.size()));
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainGreekExposure_Scalar)->Arg(2000)->Arg(100000);
+
+static void BM_ChainDeltaBandMask(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> mask(columns.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chain::delta_band_mask(columns, 0.25, 0.35, mask.data()));
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainDeltaBandMask)->Arg(2000)->Arg(100000);
+
+static void BM_ChainDeltaBandMask_Scalar(benchmark::State& state) {
+    auto columns = makeChain(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> mask(columns.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chain::abs_range_mask_impl::scalar(columns.delta.data(), 0.25, 0.35, mask.data(), columns.size()));
+    }
+    finish(state);
+}
+BENCHMARK(BM_ChainDeltaBandMask_Scalar)->Arg(2000)->Arg(100000);
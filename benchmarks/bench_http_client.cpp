@@ -0,0 +1,237 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <future>
+#include <string>
+#include <vector>
+
+#include "fixtures/loopback_server.h"
+#include "fixtures/test_data.h"
+#include "tradier/common/http_client.hpp"
+#include "tradier/client.hpp"
+#include "tradier/market.hpp"
+
+using namespace tradier;
+
+namespace {
+
+test::LoopbackServer& stubServer() {
+    static test::LoopbackServer server(test::TestData::get_sample_quotes());
+    return server;
+}
+
+// A full session of one-second bars, about 3 MB
+const std::string& timeSalesBody() {
+    static const std::string body = [] {
+        std::string body = R"({"series":{"data":[)";
+        for (int i = 0; i < 23400; ++i) {
+            if (i > 0) body += ',';
+            double price = 450.0 + (i % 500) * 0.01;
+            body += R"({"time":"2024-06-03T09:30:00","timestamp":)" + std::to_string(1717421400 + i) +
+                    R"(,"price":)" + std::to_string(price) + R"(,"open":)" + std::to_string(price) +
+                    R"(,"high":)" + std::to_string(price + 0.02) + R"(,"low":)" + std::to_string(price - 0.02) +
+                    R"(,"close":)" + std::to_string(price) + R"(,"volume":)" + std::to_string(1000 + i % 7000) +
+                    R"(,"vwap":)" + std::to_string(price) + "}";
+        }
+        body += "]}}";
+        return body;
+    }();
+    return body;
+}
+
+test::LoopbackServer& timeSalesServer() {
+    static test::LoopbackServer server(timeSalesBody());
+    return server;
+}
+
+test::LoopbackServer& compressedTimeSalesServer() {
+    static test::LoopbackServer server(timeSalesBody(), true);
+    return server;
+}
+
+test::LoopbackServer& expirationsServer() {
+    static test::LoopbackServer server([] {
+        std::string body = R"({"expirations":{"expiration":[)";
+        for (int week = 0; week < 26; ++week) {
+            if (week > 0) body += ',';
+            body += R"({"date":"2025-)" + std::string(week / 4 + 1 < 10 ? "0" : "") + std::to_string(week / 4 + 1) + "-" +
+                    std::to_string(10 + week % 4 * 5) + R"(","contract_size":100,"expiration_type":"weeklys"})";
+        }
+        body += "]}}";
+        return body;
+    }());
+    return server;
+}
+
+Config stubConfig(const test::LoopbackServer& server = stubServer()) {
+    Config config;
+    config.accessToken = test::TestData::get_test_access_token();
+    config.baseUrlOverride = server.baseUrl();
+    config.timeoutSeconds = 5;
+    return config;
+}
+
+const QueryParams& quoteParams() {
+    static const QueryParams params = {{"symbols", "AAPL,GOOGL,MSFT,AMZN,TSLA"}, {"greeks", "false"}};
+    return params;
+}
+
+// Per-endpoint distribution next to the benchmark's own mean
+void reportEndpoint(benchmark::State& state, const HttpClient& client) {
+    for (const auto& endpoint : client.getEndpointStatistics()) {
+        if (endpoint.endpoint == "GET /markets/quotes") {
+            state.counters["p50_us"] = static_cast<double>(endpoint.latency.percentile(50)) / 1000.0;
+            state.counters["p99_us"] = static_cast<double>(endpoint.latency.percentile(99)) / 1000.0;
+            state.counters["ttfb_p50_us"] = static_cast<double>(endpoint.timeToFirstByte.percentile(50)) / 1000.0;
+        }
+    }
+}
+
+}
+
+static void BM_HttpClient_Get(benchmark::State& state) {
+    HttpClient client(stubConfig());
+    
+    for (auto _ : state) {
+        auto response = client.get("/markets/quotes", quoteParams());
+        benchmark::DoNotOptimize(response.body.data());
+    }
+    
+    reportEndpoint(state, client);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HttpClient_Get)->UseRealTime();
+
+static void BM_HttpClient_GetPrepared(benchmark::State& state) {
+    HttpClient client(stubConfig());
+    auto quotes = client.prepare("GET", "/markets/quotes");
+    
+    for (auto _ : state) {
+        auto response = client.execute(quotes, quoteParams());
+        benchmark::DoNotOptimize(response.body.data());
+    }
+    
+    reportEndpoint(state, client);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HttpClient_GetPrepared)->UseRealTime();
+
+// A burst of concurrent requests through the async engine
+static void BM_HttpClient_GetAsyncBurst(benchmark::State& state) {
+    HttpClient client(stubConfig());
+    auto burst = static_cast<size_t>(state.range(0));
+    std::vector<std::future<Response>> pending;
+    pending.reserve(burst);
+    
+    for (auto _ : state) {
+        for (size_t i = 0; i < burst; ++i) {
+            pending.push_back(client.getAsync("/markets/quotes", quoteParams()));
+        }
+        for (auto& future : pending) {
+            benchmark::DoNotOptimize(future.get().status);
+        }
+        pending.clear();
+    }
+    
+    reportEndpoint(state, client);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(burst));
+}
+BENCHMARK(BM_HttpClient_GetAsyncBurst)->Arg(32)->UseRealTime();
+
+// Strategy threads asking for the same quotes at once; arg 1 coalesces them
+// into one request and one parse
+static void BM_MarketService_GetQuotesBurst(benchmark::State& state) {
+    auto config = stubConfig();
+    config.coalesceRequests = state.range(0) != 0;
+    TradierClient client(config);
+    auto market = client.market();
+    const std::vector<std::string> symbols = {"AAPL", "GOOGL", "MSFT", "AMZN", "TSLA"};
+    std::vector<SimpleAsyncResult<std::vector<Quote>>> pending;
+    pending.reserve(32);
+    
+    for (auto _ : state) {
+        for (int i = 0; i < 32; ++i) {
+            pending.push_back(market.getQuotesAsync(symbols));
+        }
+        for (auto& future : pending) {
+            benchmark::DoNotOptimize(future.get().isSuccess());
+        }
+        pending.clear();
+    }
+    
+    auto calls = static_cast<double>(state.iterations()) * 32;
+    state.counters["requests_per_call"] =
+        static_cast<double>(client.getHttpClient().getStatistics().totalRequests) / calls;
+    state.SetItemsProcessed(state.iterations() * 32);
+}
+BENCHMARK(BM_MarketService_GetQuotesBurst)->Arg(0)->Arg(1)->UseRealTime();
+
+// Buffer the whole body, then build the DOM, then the rows
+static void BM_MarketService_TimeSales(benchmark::State& state) {
+    TradierClient client(stubConfig(timeSalesServer()));
+    auto market = client.market();
+    
+    for (auto _ : state) {
+        auto rows = market.getTimeSales("SPY", "tick");
+        benchmark::DoNotOptimize(rows.value().size());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * 23400);
+}
+BENCHMARK(BM_MarketService_TimeSales)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Rows parsed inside the write callback as the body arrives; Arg(1) serves it
+// gzip-encoded, decompressed by libcurl on the way to the parser
+static void BM_MarketService_StreamTimeSales(benchmark::State& state) {
+    TradierClient client(stubConfig(state.range(0) ? compressedTimeSalesServer() : timeSalesServer()));
+    auto market = client.market();
+    double volume = 0.0;
+    
+    for (auto _ : state) {
+        auto rows = market.streamTimeSales("SPY", [&volume](const TimeSalesData& row) { volume += row.volume; }, "tick");
+        benchmark::DoNotOptimize(rows.value());
+    }
+    
+    benchmark::DoNotOptimize(volume);
+    auto stats = client.getHttpClient().getStatistics();
+    state.counters["wire_KB"] = static_cast<double>(stats.compressedBytesReceived) / state.iterations() / 1024.0;
+    state.counters["body_KB"] = static_cast<double>(stats.uncompressedBytesReceived) / state.iterations() / 1024.0;
+    state.SetItemsProcessed(state.iterations() * 23400);
+}
+BENCHMARK(BM_MarketService_StreamTimeSales)->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+
+// A scanner asking for the expirations of 500 underlyings per pass; arg 1
+// serves repeat passes from the reference-data cache
+static void BM_MarketService_ExpirationsScan(benchmark::State& state) {
+    auto config = stubConfig(expirationsServer());
+    config.cacheReferenceData = state.range(0) != 0;
+    TradierClient client(config);
+    auto market = client.market();
+    std::vector<std::string> underlyings;
+    for (int i = 0; i < 500; ++i) {
+        underlyings.push_back("SYM" + std::to_string(i));
+    }
+    
+    for (auto _ : state) {
+        for (const auto& symbol : underlyings) {
+            auto expirations = market.getOptionExpirations(symbol);
+            benchmark::DoNotOptimize(expirations.value().size());
+        }
+    }
+    
+    state.counters["requests_per_pass"] = static_cast<double>(client.getHttpClient().getStatistics().totalRequests) /
+                                          static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations() * 500);
+}
+BENCHMARK(BM_MarketService_ExpirationsScan)->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
\ No newline at end of file
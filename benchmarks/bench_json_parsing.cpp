@@ -0,0 +1,98 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+#include <string>
+
+#include "fixtures/test_data.h"
+#include "tradier/json/market.hpp"
+
+using namespace tradier;
+
+namespace {
+
+// Replicates the single fixture record `count` times under distinct symbols
+std::string replicate(const std::string& fixture, const char* outer, const char* inner, size_t count) {
+    auto json = nlohmann::json::parse(fixture);
+    const auto record = json[outer][inner][0];
+    
+    auto& records = json[outer][inner];
+    records = nlohmann::json::array();
+    for (size_t i = 0; i < count; ++i) {
+        auto copy = record;
+        copy["symbol"] = record["symbol"].get<std::string>() + std::to_string(i);
+        if (copy.contains("strike")) {
+            copy["strike"] = 100.0 + static_cast<double>(i) * 0.5;
+        }
+        records.push_back(std::move(copy));
+    }
+    return json.dump();
+}
+
+}
+
+static void BM_ParseQuotes(benchmark::State& state) {
+    auto count = static_cast<size_t>(state.range(0));
+    std::string body = replicate(test::TestData::get_sample_quotes(), "quotes", "quote", count);
+    
+    for (auto _ : state) {
+        auto quotes = json::parseQuotes(nlohmann::json::parse(body));
+        benchmark::DoNotOptimize(quotes.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(body.size()));
+}
+BENCHMARK(BM_ParseQuotes)->Arg(1)->Arg(100)->Arg(1000);
+
+static void BM_ParseOptionChains(benchmark::State& state) {
+    auto count = static_cast<size_t>(state.range(0));
+    std::string body = replicate(test::TestData::get_sample_options_chain(), "options", "option", count);
+    
+    for (auto _ : state) {
+        auto chain = json::parseOptionChains(nlohmann::json::parse(body));
+        benchmark::DoNotOptimize(chain.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(body.size()));
+}
+BENCHMARK(BM_ParseOptionChains)->Arg(1)->Arg(100)->Arg(2000);
+
+// Mapping cost alone, with the DOM already built
+static void BM_ParseOptionChains_FromDom(benchmark::State& state) {
+    auto count = static_cast<size_t>(state.range(0));
+    auto json = nlohmann::json::parse(
+        replicate(test::TestData::get_sample_options_chain(), "options", "option", count));
+    
+    for (auto _ : state) {
+        auto chain = json::parseOptionChains(json);
+        benchmark::DoNotOptimize(chain.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ParseOptionChains_FromDom)->Arg(2000);
+
+static void BM_ParseOptionChainColumns(benchmark::State& state) {
+    auto count = static_cast<size_t>(state.range(0));
+    std::string body = replicate(test::TestData::get_sample_options_chain(), "options", "option", count);
+    
+    for (auto _ : state) {
+        auto chain = json::parseOptionChainColumns(body);
+        benchmark::DoNotOptimize(chain.strike.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(body.size()));
+}
+BENCHMARK(BM_ParseOptionChainColumns)->Arg(1)->Arg(100)->Arg(2000);
@@ -0,0 +1,113 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "tradier/market.hpp"
+#include "tradier/simd/black_scholes.hpp"
+
+using namespace tradier;
+namespace pricing = tradier::simd::pricing;
+
+namespace {
+
+struct PricingBook {
+    std::vector<double> strike;
+    std::vector<double> expiry;
+    std::vector<OptionRight> right;
+    std::vector<double> volatility;
+    std::vector<double> price;
+    
+    pricing::contracts rows() const {
+        return {strike.data(), expiry.data(), right.data(), strike.size()};
+    }
+};
+
+const pricing::market kMarket{pricing::model::black_scholes, 450.0, 0.04, 0.012};
+
+PricingBook makeBook(size_t rows) {
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> strike(300.0, 600.0);
+    std::uniform_real_distribution<double> expiry(0.02, 2.0);
+    std::uniform_real_distribution<double> volatility(0.08, 0.9);
+    
+    PricingBook book;
+    for (size_t i = 0; i < rows; ++i) {
+        book.strike.push_back(strike(rng));
+        book.expiry.push_back(expiry(rng));
+        book.right.push_back(i % 2 ? OptionRight::PUT : OptionRight::CALL);
+        book.volatility.push_back(volatility(rng));
+    }
+    book.price.resize(rows);
+    pricing::outputs out;
+    out.price = book.price.data();
+    pricing::price_impl::scalar(kMarket, book.rows(), book.volatility.data(), out);
+    return book;
+}
+
+void finish(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(simd::isa_name(simd::active_isa()));
+}
+
+}
+
+// Full price-plus-greeks pass and an implied volatility solve over the same
+// book, through dispatch and through the scalar variant directly.
+
+static void BM_PriceWithGreeks(benchmark::State& state) {
+    auto book = makeBook(static_cast<size_t>(state.range(0)));
+    std::vector<double> price(book.strike.size()), delta(price.size()), gamma(price.size()),
+        theta(price.size()), vega(price.size()), rho(price.size());
+    pricing::outputs out{price.data(), delta.data(), gamma.data(), theta.data(), vega.data(), rho.data()};
+    for (auto _ : state) {
+        pricing::price(kMarket, book.rows(), book.volatility.data(), out);
+        benchmark::DoNotOptimize(price.data());
+    }
+    finish(state);
+}
+BENCHMARK(BM_PriceWithGreeks)->Arg(2000)->Arg(100000);
+
+static void BM_PriceWithGreeks_Scalar(benchmark::State& state) {
+    auto book = makeBook(static_cast<size_t>(state.range(0)));
+    std::vector<double> price(book.strike.size()), delta(price.size()), gamma(price.size()),
+        theta(price.size()), vega(price.size()), rho(price.size());
+    pricing::outputs out{price.data(), delta.data(), gamma.data(), theta.data(), vega.data(), rho.data()};
+    for (auto _ : state) {
+        pricing::price_impl::scalar(kMarket, book.rows(), book.volatility.data(), out);
+        benchmark::DoNotOptimize(price.data());
+    }
+    finish(state);
+}
+BENCHMARK(BM_PriceWithGreeks_Scalar)->Arg(2000)->Arg(100000);
+
+static void BM_ImpliedVolatility(benchmark::State& state) {
+    auto book = makeBook(static_cast<size_t>(state.range(0)));
+    std::vector<double> solved(book.strike.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pricing::implied_volatility(kMarket, book.rows(), book.price.data(), solved.data()));
+    }
+    finish(state);
+}
+BENCHMARK(BM_ImpliedVolatility)->Arg(2000)->Arg(100000);
+
+static void BM_ImpliedVolatility_Scalar(benchmark::State& state) {
+    auto book = makeBook(static_cast<size_t>(state.range(0)));
+    std::vector<double> solved(book.strike.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pricing::implied_volatility_impl::scalar(kMarket, book.rows(), book.price.data(),
+                                                                          solved.data(), {}));
+    }
+    finish(state);
+}
+BENCHMARK(BM_ImpliedVolatility_Scalar)->Arg(2000)->Arg(100000);
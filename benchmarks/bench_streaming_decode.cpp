@@ -0,0 +1,233 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "fixtures/test_data.h"
+#include "tradier/client.hpp"
+#include "tradier/json/streaming.hpp"
+#include "tradier/market_state.hpp"
+
+using namespace tradier;
+
+namespace {
+
+const std::vector<std::string>& streamFrames() {
+    static const std::vector<std::string> frames = {
+        R"({"type":"quote","symbol":"SPY","bid":451.24,"bidsz":12,"bidexch":"Q","biddate":"1640995200000",)"
+        R"("ask":451.26,"asksz":9,"askexch":"Z","askdate":"1640995200000"})",
+        R"({"type":"trade","symbol":"SPY","exch":"Q","price":"451.25","size":"100","cvol":"34000000",)"
+        R"("date":"1640995200000","last":"451.25"})",
+        R"({"type":"timesale","symbol":"SPY","exch":"Q","bid":"451.24","ask":"451.26","last":"451.25",)"
+        R"("size":"100","date":"1640995200000","seq":123456,"flag":"","cancel":false,"correction":false,"session":"normal"})",
+        R"({"type":"summary","symbol":"SPY","open":"449.10","high":"452.00","low":"448.75","prevClose":"450.02"})"
+    };
+    return frames;
+}
+
+double numericField(const nlohmann::json& json, const char* key) {
+    if (!json.contains(key) || json[key].is_null()) return 0.0;
+    if (json[key].is_number()) return json[key].get<double>();
+    if (json[key].is_string()) {
+        std::string str = json[key].get<std::string>();
+        return str.empty() ? 0.0 : std::stod(str);
+    }
+    return 0.0;
+}
+
+// The pre-decoder path: full DOM parse, then per-key lookups and stod
+void decodeWithDom(const std::string& frame, QuoteEvent& quote, TradeEvent& trade, TimesaleEvent& timesale) {
+    auto json = nlohmann::json::parse(frame);
+    std::string type = json["type"];
+    std::string symbol = json.value("symbol", "");
+    
+    if (type == "quote") {
+        quote.symbol = symbol;
+        quote.bid = numericField(json, "bid");
+        quote.ask = numericField(json, "ask");
+        quote.bidSize = static_cast<int>(numericField(json, "bidsz"));
+        quote.askSize = static_cast<int>(numericField(json, "asksz"));
+        quote.bidExchange = json.value("bidexch", "");
+        quote.bidDate = json.value("biddate", "");
+        quote.askExchange = json.value("askexch", "");
+        quote.askDate = json.value("askdate", "");
+    } else if (type == "trade") {
+        trade.symbol = symbol;
+        trade.exchange = json.value("exch", "");
+        trade.price = numericField(json, "price");
+        trade.size = static_cast<int>(numericField(json, "size"));
+        trade.cvol = static_cast<long>(numericField(json, "cvol"));
+        trade.last = numericField(json, "last");
+        trade.date = json.value("date", "");
+    } else if (type == "timesale") {
+        timesale.symbol = symbol;
+        timesale.exchange = json.value("exch", "");
+        timesale.bid = numericField(json, "bid");
+        timesale.ask = numericField(json, "ask");
+        timesale.last = numericField(json, "last");
+        timesale.size = static_cast<int>(numericField(json, "size"));
+        timesale.seq = static_cast<int>(numericField(json, "seq"));
+        timesale.date = json.value("date", "");
+        timesale.flag = json.value("flag", "");
+        timesale.cancel = json.value("cancel", false);
+        timesale.correction = json.value("correction", false);
+        timesale.session = json.value("session", "");
+    }
+}
+
+}
+
+static void BM_StreamDecode_Dom(benchmark::State& state) {
+    const auto& frames = streamFrames();
+    QuoteEvent quote;
+    TradeEvent trade;
+    TimesaleEvent timesale;
+    size_t index = 0;
+    
+    for (auto _ : state) {
+        decodeWithDom(frames[index], quote, trade, timesale);
+        benchmark::DoNotOptimize(quote.bid);
+        benchmark::DoNotOptimize(trade.price);
+        index = (index + 1) % frames.size();
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StreamDecode_Dom);
+
+static void BM_StreamDecode_SinglePass(benchmark::State& state) {
+    const auto& frames = streamFrames();
+    json::StreamEventBuffer buffer;
+    size_t index = 0;
+    
+    for (auto _ : state) {
+        auto status = json::decodeStreamEvent(frames[index], buffer);
+        benchmark::DoNotOptimize(status);
+        benchmark::DoNotOptimize(buffer.quote.bid);
+        index = (index + 1) % frames.size();
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StreamDecode_SinglePass);
+
+
+static void BM_StreamDecode_Compact(benchmark::State& state) {
+    const auto& frames = streamFrames();
+    SymbolTable symbols;
+    json::CompactEventBuffer buffer;
+    size_t index = 0;
+    
+    for (auto _ : state) {
+        auto status = json::decodeCompactStreamEvent(frames[index], symbols, buffer);
+        benchmark::DoNotOptimize(status);
+        benchmark::DoNotOptimize(buffer.quote.bid);
+        index = (index + 1) % frames.size();
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StreamDecode_Compact);
+
+namespace {
+
+struct StreamingHarness {
+    TradierClient client;
+    StreamingService streaming;
+    double sink = 0.0;
+    
+    StreamingHarness() : client(makeConfig()), streaming(client) {
+        StreamSession session;
+        session.sessionId = "benchmark";
+        session.isActive = true;
+        
+        // No connection is opened; subscribing only registers the handlers
+        streaming.subscribeToQuotes(session, {"SPY"}, [this](const QuoteEvent& event) { sink += event.bid; });
+        streaming.subscribeToTrades(session, {"SPY"}, [this](const TradeEvent& event) { sink += event.price; });
+        streaming.subscribeToTimesales(session, {"SPY"}, [this](const TimesaleEvent& event) { sink += event.last; });
+        streaming.subscribeToSummary(session, {"SPY"}, [this](const SummaryEvent& event) { sink += event.open; });
+    }
+    
+    static Config makeConfig() {
+        Config config;
+        config.accessToken = test::TestData::get_test_access_token();
+        return config;
+    }
+};
+
+void runHandleMessage(benchmark::State& state, const std::vector<std::string>& frames) {
+    StreamingHarness harness;
+    size_t index = 0;
+    
+    for (auto _ : state) {
+        harness.streaming.processMessage(frames[index]);
+        index = (index + 1) % frames.size();
+    }
+    
+    benchmark::DoNotOptimize(harness.sink);
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+// Full service path: decode, filters and handler dispatch
+static void BM_StreamingService_HandleMessage(benchmark::State& state) {
+    runHandleMessage(state, streamFrames());
+}
+BENCHMARK(BM_StreamingService_HandleMessage);
+
+// The test fixtures carry numeric dates, which the single-pass decoder hands
+// to the full-parse path
+static void BM_StreamingService_HandleMessage_Fallback(benchmark::State& state) {
+    runHandleMessage(state, {test::TestData::get_sample_quote_stream(), test::TestData::get_sample_trade_stream()});
+}
+BENCHMARK(BM_StreamingService_HandleMessage_Fallback);
+// Frames applied to a MarketStateCache only, with no handlers registered
+static void BM_StreamingService_MarketState(benchmark::State& state) {
+    TradierClient client(StreamingHarness::makeConfig());
+    StreamingService streaming(client);
+    auto cache = streaming.enableMarketState();
+    const auto& frames = streamFrames();
+    size_t index = 0;
+    
+    for (auto _ : state) {
+        streaming.processMessage(frames[index]);
+        index = (index + 1) % frames.size();
+    }
+    
+    benchmark::DoNotOptimize(cache->snapshot("SPY"));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StreamingService_MarketState);
+
+static void BM_MarketState_Snapshot(benchmark::State& state) {
+    auto symbols = std::make_shared<SymbolTable>();
+    MarketStateCache cache(symbols);
+    CompactQuoteEvent quote;
+    for (int i = 0; i < 4096; ++i) {
+        quote.symbol = symbols->intern("SYM" + std::to_string(i));
+        quote.bid = i;
+        cache.apply(quote);
+    }
+    
+    MarketState snapshot;
+    SymbolId id = 0;
+    for (auto _ : state) {
+        cache.snapshot(id, snapshot);
+        benchmark::DoNotOptimize(snapshot);
+        id = (id + 1) & 4095;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MarketState_Snapshot);
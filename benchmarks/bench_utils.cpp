@@ -0,0 +1,111 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include <benchmark/benchmark.h>
+#include <curl/curl.h>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "fixtures/test_data.h"
+#include "tradier/common/utils.hpp"
+
+using namespace tradier;
+
+static void BM_UrlEncode_Symbols(benchmark::State& state) {
+    std::string symbols;
+    for (const auto& symbol : test::TestData::get_test_symbols()) {
+        symbols += symbols.empty() ? symbol : "," + symbol;
+    }
+    
+    for (auto _ : state) {
+        auto encoded = utils::urlEncode(symbols);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+    
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(symbols.size()));
+}
+BENCHMARK(BM_UrlEncode_Symbols);
+
+// A wide option-symbol list, the largest query strings the library builds
+static void BM_UrlEncode_OptionSymbols(benchmark::State& state) {
+    std::string symbols;
+    for (int i = 0; i < 200; ++i) {
+        if (!symbols.empty()) symbols += ',';
+        symbols += "SPY250117C00" + std::to_string(400 + i) + "000";
+    }
+    
+    for (auto _ : state) {
+        auto encoded = utils::urlEncode(symbols);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+    
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(symbols.size()));
+}
+BENCHMARK(BM_UrlEncode_OptionSymbols);
+
+namespace {
+
+// The form fields placeMultiLegOrder sends for a four-leg iron condor
+std::map<std::string, std::string> ironCondorForm() {
+    std::map<std::string, std::string> params = {
+        {"class", "multileg"}, {"type", "credit"}, {"duration", "day"}, {"price", "1.250000"},
+        {"tag", "condor-weekly"}};
+    const char* legs[][2] = {{"SPY250117P00400000", "buy_to_open"}, {"SPY250117P00405000", "sell_to_open"},
+                             {"SPY250117C00450000", "sell_to_open"}, {"SPY250117C00455000", "buy_to_open"}};
+    for (size_t i = 0; i < 4; ++i) {
+        std::string prefix = "option[" + std::to_string(i) + "]";
+        params[prefix + "[option_symbol]"] = legs[i][0];
+        params[prefix + "[side]"] = legs[i][1];
+        params[prefix + "[quantity]"] = "1";
+    }
+    return params;
+}
+
+}
+
+// The previous form encoder: a fresh curl easy handle per key and per value
+static void BM_FormEncode_MultiLegOrder_CurlEscape(benchmark::State& state) {
+    auto params = ironCondorForm();
+    auto escape = [](const std::string& value) {
+        std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> handle(curl_easy_init(), &curl_easy_cleanup);
+        std::unique_ptr<char, decltype(&curl_free)> encoded(
+            curl_easy_escape(handle.get(), value.c_str(), static_cast<int>(value.length())), &curl_free);
+        return std::string(encoded.get());
+    };
+    
+    for (auto _ : state) {
+        std::string body;
+        bool first = true;
+        for (const auto& [key, value] : params) {
+            if (!first) body += "&";
+            body += escape(key) + "=" + escape(value);
+            first = false;
+        }
+        benchmark::DoNotOptimize(body.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormEncode_MultiLegOrder_CurlEscape);
+
+static void BM_FormEncode_MultiLegOrder(benchmark::State& state) {
+    auto params = ironCondorForm();
+    
+    for (auto _ : state) {
+        std::string body;
+        utils::appendUrlEncodedParams(body, params);
+        benchmark::DoNotOptimize(body.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormEncode_MultiLegOrder);
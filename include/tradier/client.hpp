@@ -24,11 +24,15 @@ class TradingService;
 class StreamingService;
 class MarketService;
 class WatchlistService;
+class SingleFlight;
+class ResponseCache;
 
 class TradierClient {
 private:
     Config config_;
     std::unique_ptr<HttpClient> httpClient_;
+    std::shared_ptr<SingleFlight> requestCoalescer_;
+    std::shared_ptr<ResponseCache> responseCache_;
     
 public:
     explicit TradierClient(const Config& config);
@@ -53,6 +57,14 @@ public:
     HttpClient& getHttpClient() { return *httpClient_; }
     const HttpClient& getHttpClient() const { return *httpClient_; }
     
+    // Shared by the services to coalesce identical in-flight GETs; null
+    // when Config::coalesceRequests is off
+    const std::shared_ptr<SingleFlight>& requestCoalescer() const { return requestCoalescer_; }
+    
+    // Reference-data cache used by MarketService, for TTLs and statistics;
+    // null when Config::cacheReferenceData is off
+    const std::shared_ptr<ResponseCache>& responseCache() const { return responseCache_; }
+    
     // Convenience methods for rate limiting
     void setRateLimit(int maxRequestsPerWindow, std::chrono::milliseconds windowDuration);
     void enableRateLimit(bool enabled = true);
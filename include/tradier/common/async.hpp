@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <future>
 #include <functional>
 #include <thread>
@@ -175,18 +177,27 @@ public:
         static ThreadPool instance;
         return instance;
     }
+    
+    // For work that blocks on I/O, such as synchronous HTTP calls and their
+    // rate-limit waits. Kept apart from getInstance(), which decodes async
+    // replies, so a backlog of blocking calls cannot starve CPU work.
+    static ThreadPool& getBlockingInstance() {
+        static ThreadPool instance(std::max(2 * std::thread::hardware_concurrency(), 8u));
+        return instance;
+    }
 };
 
-// Async execution utilities
+// Async execution utilities. syncFunc is expected to block (a synchronous
+// API call), so it runs on the blocking pool.
 template<typename T>
 AsyncResult<T> makeAsync(std::function<ApiResult<T>()> syncFunc) {
-    return ThreadPool::getInstance().enqueue(std::move(syncFunc));
+    return ThreadPool::getBlockingInstance().enqueue(std::move(syncFunc));
 }
 
 template<typename T>
 void executeAsync(std::function<ApiResult<T>()> syncFunc, AsyncCallback<T> callback) {
     // Execute the function directly in the thread pool to avoid future chaining issues
-    ThreadPool::getInstance().enqueue([syncFunc = std::move(syncFunc), callback = std::move(callback)]() mutable {
+    ThreadPool::getBlockingInstance().enqueue([syncFunc = std::move(syncFunc), callback = std::move(callback)]() mutable {
         try {
             auto result = syncFunc();
             callback(result);
@@ -320,65 +331,171 @@ public:
     }
 };
 
-// Rate limiter for async operations
+// Token bucket in its GCRA form: the whole state is one atomic "theoretical
+// arrival time", so acquiring never takes a lock. maxRequests may go out in a
+// burst, after which tokens refill evenly across the window. reserve() lets a
+// caller take a future token and schedule itself instead of blocking.
+// Server feedback adds a second limit: a count of requests allowed before
+// the server's window resets, after which the bucket is held until then.
 class RateLimiter {
 private:
-    std::chrono::steady_clock::time_point windowStart_;
-    std::atomic<int> requestCount_{0};
-    const int maxRequests_;
-    const std::chrono::milliseconds windowDuration_;
-    mutable std::mutex mutex_;
-    std::condition_variable condition_;
+    using Clock = std::chrono::steady_clock;
     
-public:
-    RateLimiter(int maxRequests, std::chrono::milliseconds windowDuration)
-        : maxRequests_(maxRequests), windowDuration_(windowDuration) {
-        windowStart_ = std::chrono::steady_clock::now();
+    std::atomic<int64_t> interval_{0};    // ns between tokens
+    std::atomic<int64_t> tolerance_{0};   // ns of burst: (capacity - 1) * interval
+    std::atomic<int64_t> arrival_{0};     // theoretical arrival time on Clock, ns
+    std::atomic<int> capacity_{0};
+    std::atomic<int64_t> windowNs_{0};
+    std::atomic<int64_t> resetAt_{0};     // server window reset on Clock, ns
+    std::atomic<int64_t> beforeReset_{0}; // requests still allowed before resetAt_
+    
+    static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
     }
     
-    bool tryAcquire() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        auto now = std::chrono::steady_clock::now();
-        
-        if (now - windowStart_ > windowDuration_) {
-            windowStart_ = now;
-            requestCount_ = 0;
+    void raiseArrival(int64_t floor) {
+        int64_t current = arrival_.load(std::memory_order_relaxed);
+        while (current < floor && !arrival_.compare_exchange_weak(current, floor, std::memory_order_relaxed)) {}
+    }
+    
+    // Takes one of the requests allowed before the server's reset. Once they
+    // are gone the bucket is held until the reset and this returns false.
+    bool claimBeforeReset(int64_t t) {
+        int64_t reset = resetAt_.load(std::memory_order_relaxed);
+        if (t >= reset) {
+            return true;
         }
-        
-        if (requestCount_ < maxRequests_) {
-            ++requestCount_;
+        if (beforeReset_.fetch_sub(1, std::memory_order_relaxed) > 0) {
             return true;
         }
-        
+        beforeReset_.fetch_add(1, std::memory_order_relaxed);
+        raiseArrival(reset + tolerance_.load(std::memory_order_relaxed));
         return false;
     }
     
-    void waitForSlot() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        
-        while (!tryAcquireInternal()) {
-            auto timeToWait = windowDuration_ - (std::chrono::steady_clock::now() - windowStart_);
-            if (timeToWait > std::chrono::milliseconds(0)) {
-                condition_.wait_for(lock, timeToWait);
+    void releaseBeforeReset(int64_t t) {
+        if (t < resetAt_.load(std::memory_order_relaxed)) {
+            beforeReset_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
+public:
+    RateLimiter(int maxRequests, std::chrono::milliseconds windowDuration) {
+        setRate(maxRequests, windowDuration);
+        arrival_.store(now(), std::memory_order_relaxed);
+    }
+    
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+    
+    void setRate(int maxRequests, std::chrono::milliseconds windowDuration) {
+        int64_t window = std::max<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(windowDuration).count(), 1);
+        int capacity = std::max(maxRequests, 1);
+        int64_t interval = std::max<int64_t>(window / capacity, 1);
+        interval_.store(interval, std::memory_order_relaxed);
+        tolerance_.store(interval * (capacity - 1), std::memory_order_relaxed);
+        capacity_.store(capacity, std::memory_order_relaxed);
+        windowNs_.store(window, std::memory_order_relaxed);
+    }
+    
+    int capacity() const {
+        return capacity_.load(std::memory_order_relaxed);
+    }
+    
+    bool tryAcquire() {
+        int64_t t = now();
+        int64_t interval = interval_.load(std::memory_order_relaxed);
+        int64_t tolerance = tolerance_.load(std::memory_order_relaxed);
+        if (!claimBeforeReset(t)) {
+            return false;
+        }
+        int64_t arrival = arrival_.load(std::memory_order_relaxed);
+        for (;;) {
+            int64_t start = std::max(arrival, t);
+            if (start - t > tolerance) {
+                releaseBeforeReset(t);
+                return false;
+            }
+            if (arrival_.compare_exchange_weak(arrival, start + interval, std::memory_order_relaxed)) {
+                return true;
             }
         }
     }
     
-private:
-    bool tryAcquireInternal() {
-        auto now = std::chrono::steady_clock::now();
+    // Always takes a token, returning how long to wait before using it.
+    // Waiters are served in reservation order.
+    std::chrono::nanoseconds reserve() {
+        int64_t t = now();
+        claimBeforeReset(t);
+        int64_t interval = interval_.load(std::memory_order_relaxed);
+        int64_t tolerance = tolerance_.load(std::memory_order_relaxed);
+        int64_t arrival = arrival_.load(std::memory_order_relaxed);
+        int64_t start = 0;
+        do {
+            start = std::max(arrival, t);
+        } while (!arrival_.compare_exchange_weak(arrival, start + interval, std::memory_order_relaxed));
+        return std::chrono::nanoseconds(std::max<int64_t>(start - tolerance - t, 0));
+    }
+    
+    void waitForSlot() {
+        auto wait = reserve();
+        if (wait.count() > 0) {
+            std::this_thread::sleep_for(wait);
+        }
+    }
+    
+    // Tokens that could be taken right now
+    double available() const {
+        int64_t interval = interval_.load(std::memory_order_relaxed);
+        int64_t tolerance = tolerance_.load(std::memory_order_relaxed);
+        int64_t t = now();
+        int64_t backlog = std::max<int64_t>(arrival_.load(std::memory_order_relaxed) - t, 0);
+        double tokens = std::max(0.0, static_cast<double>(tolerance - backlog) / static_cast<double>(interval) + 1.0);
+        if (t < resetAt_.load(std::memory_order_relaxed)) {
+            tokens = std::min(tokens, static_cast<double>(std::max<int64_t>(beforeReset_.load(std::memory_order_relaxed), 0)));
+        }
+        return tokens;
+    }
+    
+    // Server feedback: at most `remaining` more requests are accepted before
+    // the server's window resets in `untilReset`. Up to `remaining` tokens
+    // stay available at the bucket's own rate; once they are spent the next
+    // one waits for the reset. Only ever tightens the bucket, so it stays
+    // safe when other clients share the same budget.
+    void calibrate(int64_t remaining, std::chrono::nanoseconds untilReset) {
+        int64_t t = now();
+        int64_t interval = interval_.load(std::memory_order_relaxed);
+        int64_t tolerance = tolerance_.load(std::memory_order_relaxed);
+        int64_t reset = t + std::max<int64_t>(untilReset.count(), 0);
+        remaining = std::max<int64_t>(remaining, 0);
         
-        if (now - windowStart_ > windowDuration_) {
-            windowStart_ = now;
-            requestCount_ = 0;
+        if (remaining == 0) {
+            raiseArrival(reset + tolerance);
+            return;
         }
         
-        if (requestCount_ < maxRequests_) {
-            ++requestCount_;
-            return true;
+        // No more than `remaining` in a burst
+        raiseArrival(t + tolerance + interval - remaining * interval);
+        if (reset <= t) {
+            return;
         }
         
-        return false;
+        // A report for the window already tracked (reset times jitter with
+        // the clocks) can only lower its count; a later window replaces it
+        int64_t tracked = resetAt_.load(std::memory_order_relaxed);
+        if (tracked > t && reset <= tracked + interval) {
+            int64_t current = beforeReset_.load(std::memory_order_relaxed);
+            while (current > remaining &&
+                   !beforeReset_.compare_exchange_weak(current, remaining, std::memory_order_relaxed)) {}
+        } else {
+            beforeReset_.store(remaining, std::memory_order_relaxed);
+            resetAt_.store(reset, std::memory_order_relaxed);
+        }
+    }
+    
+    std::chrono::milliseconds window() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::nanoseconds(windowNs_.load(std::memory_order_relaxed)));
     }
 };
 
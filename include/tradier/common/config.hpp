@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace tradier {
@@ -20,10 +21,38 @@ struct Config {
     std::string accountNumber;
     bool sandboxMode = true;
     int timeoutSeconds = 30;
+    int maxConnections = 8;
+    
+    // Multiplex requests as HTTP/2 streams over shared TLS connections
+    bool http2 = false;
+    int maxConcurrentStreams = 100;
+    
+    // Identical market data GETs issued while one is already in flight wait
+    // for and share its response instead of sending their own
+    bool coalesceRequests = true;
+    
+    // Advertise every Content-Encoding libcurl can decode (gzip and deflate,
+    // plus brotli and zstd when built with them). Bodies are decompressed as
+    // they arrive, before buffering or streaming
+    bool compressResponses = true;
+    
+    // Keep decoded reference data (option expirations, strikes and lookups,
+    // the calendar, the ETB list, fundamentals) in memory for a TTL per
+    // endpoint, see ResponseCache
+    bool cacheReferenceData = false;
+    size_t referenceCacheBytes = 32 * 1024 * 1024;
+    
+    // Replaces the sandbox/production REST endpoint, e.g. for a local stub.
+    // Every request carries the bearer token to this host, so it is only
+    // settable in code and never read from the environment.
+    std::string baseUrlOverride;
     
     static Config fromEnvironment();
     
     std::string baseUrl() const {
+        if (!baseUrlOverride.empty()) {
+            return baseUrlOverride;
+        }
         return sandboxMode ? "https://sandbox.tradier.com/v1" : "https://api.tradier.com/v1";
     }
     
@@ -0,0 +1,120 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace tradier {
+
+// Bounded lock-free ring (Vyukov's sequence-per-slot design). Safe for any
+// number of producers and consumers; the streaming dispatcher uses it with a
+// single producer. Slots are preallocated and reused, so values keep their
+// string capacity from one lap to the next: producers fill a slot in place
+// and consumers typically swap its contents out.
+template<typename T>
+class EventRing {
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+
+    alignas(CACHE_LINE) std::atomic<size_t> enqueuePos_{0};
+    alignas(CACHE_LINE) std::atomic<size_t> dequeuePos_{0};
+
+    static size_t roundUpCapacity(size_t capacity) {
+        size_t result = 2;
+        while (result < capacity) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+public:
+    explicit EventRing(size_t capacity)
+        : slots_(std::make_unique<Slot[]>(roundUpCapacity(capacity))),
+          mask_(roundUpCapacity(capacity) - 1) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    EventRing(const EventRing&) = delete;
+    EventRing& operator=(const EventRing&) = delete;
+
+    // fill(T&) runs with exclusive access to the claimed slot
+    template<typename Fill>
+    bool tryPush(Fill&& fill) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    fill(slot.value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // consume(T&) runs with exclusive access; keep it short, the slot is not
+    // reusable by producers until it returns
+    template<typename Consume>
+    bool tryPop(Consume&& consume) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    consume(slot.value);
+                    slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t capacity() const {
+        return mask_ + 1;
+    }
+
+    // Approximate under concurrent use
+    size_t size() const {
+        size_t enqueued = enqueuePos_.load(std::memory_order_relaxed);
+        size_t dequeued = dequeuePos_.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+};
+
+}
\ No newline at end of file
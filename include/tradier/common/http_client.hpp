@@ -14,11 +14,46 @@
 #include "tradier/common/types.hpp"
 #include "tradier/common/config.hpp"
 #include "tradier/common/async.hpp"
+#include "tradier/common/latency_histogram.hpp"
+#include "tradier/common/request_scheduler.hpp"
 #include <memory>
 #include <chrono>
+#include <functional>
+#include <future>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace tradier {
 
+// Tradier meters these separately, each with its own per-minute allowance
+enum class RateLimitCategory {
+    STANDARD,       // accounts, watchlists, order status and everything else
+    MARKET_DATA,    // /markets
+    TRADING         // placing, changing and cancelling orders
+};
+
+// A request with its fixed parts resolved once by HttpClient::prepare(): the
+// full URL, the shared header list, its endpoint statistics, rate-limit
+// category and priority. Each call then only encodes its parameters. Copies
+// share the template; it is only valid with the client that prepared it.
+class PreparedRequest {
+public:
+    PreparedRequest() = default;
+    
+    const std::string& method() const;
+    const std::string& endpoint() const;
+    explicit operator bool() const { return route_ != nullptr; }
+
+private:
+    friend class HttpClient;
+    struct Route;
+    std::shared_ptr<const Route> route_;
+    
+    explicit PreparedRequest(std::shared_ptr<const Route> route) : route_(std::move(route)) {}
+};
+
 class HttpClient {
 private:
     class Impl;
@@ -38,10 +73,71 @@ public:
     Response put(const std::string& endpoint, const FormParams& params = {});
     Response del(const std::string& endpoint, const QueryParams& params = {});
     
-    // Rate limiting configuration
+    // With extra request headers, such as If-None-Match for revalidation
+    Response get(const std::string& endpoint, const QueryParams& params, const Headers& headers);
+    
+    // Hands a 2xx response body to `onBody` chunk by chunk as it arrives
+    // instead of collecting it in Response::body, so large payloads can be
+    // parsed while the rest is still downloading. Other statuses are
+    // buffered as usual. onBody runs on the transferring thread (the I/O
+    // thread with HTTP/2); an exception it throws aborts the transfer and is
+    // rethrown here. Failures are only retried before any data is delivered.
+    using BodyHandler = std::function<void(std::string_view chunk)>;
+    Response getStreaming(const std::string& endpoint, const QueryParams& params, BodyHandler onBody);
+    
+    // Non-blocking requests, multiplexed by a single curl_multi I/O thread owned
+    // by this client. Handlers run on that thread, so they should hand heavy
+    // work such as parsing off instead of blocking it. On transport failure the
+    // handler receives an empty Response and the ConnectionError as `error`.
+    using CompletionHandler = std::function<void(Response&& response, std::exception_ptr error)>;
+    
+    void getAsync(const std::string& endpoint, const QueryParams& params, CompletionHandler handler);
+    void postAsync(const std::string& endpoint, const FormParams& params, CompletionHandler handler);
+    void putAsync(const std::string& endpoint, const FormParams& params, CompletionHandler handler);
+    void delAsync(const std::string& endpoint, const QueryParams& params, CompletionHandler handler);
+    void getAsync(const std::string& endpoint, const QueryParams& params, const Headers& headers, CompletionHandler handler);
+    
+    std::future<Response> getAsync(const std::string& endpoint, const QueryParams& params = {});
+    std::future<Response> postAsync(const std::string& endpoint, const FormParams& params = {});
+    std::future<Response> putAsync(const std::string& endpoint, const FormParams& params = {});
+    std::future<Response> delAsync(const std::string& endpoint, const QueryParams& params = {});
+    
+    // Prepared requests for hot paths such as quotes, order placement and
+    // cancels. `pathSuffix` is appended to the prepared endpoint, e.g. an
+    // order id after prepare("DELETE", "/accounts/VA000001/orders/"); a
+    // trailing '/' is recorded in the endpoint statistics as "{id}".
+    PreparedRequest prepare(const std::string& method, const std::string& endpoint);
+    Response execute(const PreparedRequest& request, const QueryParams& params = {}, std::string_view pathSuffix = {});
+    void executeAsync(const PreparedRequest& request, const QueryParams& params, CompletionHandler handler,
+                      std::string_view pathSuffix = {});
+    std::future<Response> executeAsync(const PreparedRequest& request, const QueryParams& params = {},
+                                       std::string_view pathSuffix = {});
+    
+    // Rate limiting: one token bucket per category, defaulting to Tradier's
+    // allowances (120/min for standard and market data, 60/min for trading;
+    // 60/min each in sandbox). While enabled, X-Ratelimit-Available/-Expiry
+    // response headers and 429s tighten the matching bucket, blocking calls
+    // wait for a token and async calls are scheduled on the I/O thread's
+    // timer queue instead of blocking the caller.
     void setRateLimit(int maxRequestsPerWindow, std::chrono::milliseconds windowDuration);
+    void setRateLimit(RateLimitCategory category, int maxRequestsPerWindow, std::chrono::milliseconds windowDuration);
     void enableRateLimit(bool enabled = true);
     
+    static RateLimitCategory rateLimitCategory(const std::string& method, const std::string& endpoint);
+    
+    // Priority scheduling: while enabled, requests wait for admission by
+    // RequestPriority before taking a rate-limit token, so an order cancel
+    // is not stuck behind a backfill. At most maxConnections requests (times
+    // maxConcurrentStreams with HTTP/2) are admitted at once; by default
+    // QUOTES may hold half of those and BULK a quarter, and QUOTES requests
+    // queued for over 2s are dropped. Dropped requests fail with TimeoutError.
+    // Deadlines are checked when a request is queued or a slot frees up, and
+    // a dropped async request's handler runs on the thread that did so.
+    void setPriorityLimits(RequestPriority priority, size_t maxInFlight, std::chrono::milliseconds maxQueueDelay);
+    void enablePriorityScheduling(bool enabled = true);
+    
+    static RequestPriority requestPriority(const std::string& method, const std::string& endpoint);
+    
     // Retry configuration
     void setRetryPolicy(int maxRetries, std::chrono::milliseconds initialDelay, double backoffMultiplier = 2.0);
     void enableRetries(bool enabled = true);
@@ -53,10 +149,44 @@ public:
         uint64_t failedRequests = 0;
         uint64_t rateLimitedRequests = 0;
         uint64_t retriedRequests = 0;
+        uint64_t poolWaits = 0;
+        uint64_t connectionsOpened = 0;
+        uint64_t http2Responses = 0;
+        uint64_t peakInFlight = 0;
+        uint64_t droppedRequests = 0;
+        // Response body bytes across endpoints, see EndpointStatistics
+        uint64_t compressedBytesReceived = 0;
+        uint64_t uncompressedBytesReceived = 0;
         std::chrono::milliseconds totalLatency{0};
     };
     
+    // Per endpoint, keyed by method and path with id-like segments (any
+    // containing a digit) collapsed, e.g. "GET /accounts/{id}/orders".
+    // Latencies are nanoseconds. `latency` spans the whole call including
+    // retries and backoff. The phase histograms are per attempt from libcurl's
+    // timings; name lookup, connect and TLS are only recorded for attempts
+    // that opened a connection, and timeToFirstByte runs from the request
+    // being sent to the first response byte. compressedBytes counts response
+    // bodies as they came off the wire and uncompressedBytes as delivered
+    // after decoding; the two match for responses sent without compression.
+    struct EndpointStatistics {
+        std::string endpoint;
+        uint64_t requests = 0;
+        uint64_t failures = 0;
+        uint64_t attempts = 0;
+        uint64_t bytesSent = 0;
+        uint64_t bytesReceived = 0;
+        uint64_t compressedBytes = 0;
+        uint64_t uncompressedBytes = 0;
+        LatencyHistogram::Snapshot latency;
+        LatencyHistogram::Snapshot nameLookup;
+        LatencyHistogram::Snapshot connect;
+        LatencyHistogram::Snapshot tlsHandshake;
+        LatencyHistogram::Snapshot timeToFirstByte;
+    };
+    
     Statistics getStatistics() const;
+    std::vector<EndpointStatistics> getEndpointStatistics() const;
     void resetStatistics();
 };
 
@@ -0,0 +1,158 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace tradier {
+
+// Log-linear histogram in the style of HdrHistogram: 16 linear sub-buckets
+// per power of two, so any reported percentile is within 1/16 of the true
+// value. Samples are nanoseconds for the latency users; anything past
+// 2^40 (about 18 minutes) lands in the last bucket. Recording is a handful
+// of relaxed atomic adds and is safe from any thread.
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+    static constexpr uint64_t SUB_BUCKETS = uint64_t{1} << SUB_BUCKET_BITS;
+    static constexpr unsigned MAX_VALUE_BITS = 40;
+    static constexpr size_t BUCKETS = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+    
+    static size_t bucketFor(uint64_t value) {
+        value = std::min(value, (uint64_t{1} << MAX_VALUE_BITS) - 1);
+        if (value < SUB_BUCKETS) {
+            return static_cast<size_t>(value);
+        }
+        unsigned shift = static_cast<unsigned>(std::bit_width(value)) - 1 - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKETS + ((value >> shift) & (SUB_BUCKETS - 1));
+    }
+    
+    // Largest value that maps to the bucket
+    static uint64_t bucketLimit(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        unsigned shift = static_cast<unsigned>(index / SUB_BUCKETS) - 1;
+        return ((SUB_BUCKETS + index % SUB_BUCKETS + 1) << shift) - 1;
+    }
+    
+    struct Snapshot {
+        std::array<uint64_t, BUCKETS> counts{};
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t min = 0;
+        uint64_t max = 0;
+        
+        double mean() const {
+            return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+        }
+        
+        // Upper edge of the bucket holding the p-th percentile (0-100),
+        // capped at the largest sample
+        uint64_t percentile(double p) const {
+            if (count == 0) {
+                return 0;
+            }
+            auto rank = static_cast<uint64_t>(std::clamp(p, 0.0, 100.0) / 100.0 * static_cast<double>(count));
+            rank = std::clamp<uint64_t>(rank, 1, count);
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                seen += counts[i];
+                if (seen >= rank) {
+                    return std::min(bucketLimit(i), max);
+                }
+            }
+            return max;
+        }
+        
+        void merge(const Snapshot& other) {
+            if (other.count == 0) {
+                return;
+            }
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                counts[i] += other.counts[i];
+            }
+            min = count ? std::min(min, other.min) : other.min;
+            max = std::max(max, other.max);
+            count += other.count;
+            sum += other.sum;
+        }
+    };
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> counts_{};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> max_{0};
+
+public:
+    LatencyHistogram() = default;
+    
+    LatencyHistogram(const LatencyHistogram& other) {
+        *this = other;
+    }
+    
+    LatencyHistogram& operator=(const LatencyHistogram& other) {
+        if (this != &other) {
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                counts_[i].store(other.counts_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            sum_.store(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            min_.store(other.min_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            max_.store(other.max_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        return *this;
+    }
+    
+    void record(uint64_t value) {
+        counts_[bucketFor(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+        
+        uint64_t seen = min_.load(std::memory_order_relaxed);
+        while (value < seen && !min_.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+        seen = max_.load(std::memory_order_relaxed);
+        while (value > seen && !max_.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+    }
+    
+    // Concurrent records may be partially included; totals are summed from
+    // the buckets so count always matches them
+    Snapshot snapshot() const {
+        Snapshot result;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            result.counts[i] = counts_[i].load(std::memory_order_relaxed);
+            result.count += result.counts[i];
+        }
+        if (result.count > 0) {
+            result.sum = sum_.load(std::memory_order_relaxed);
+            result.min = min_.load(std::memory_order_relaxed);
+            result.max = max_.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+    
+    void reset() {
+        for (auto& bucket : counts_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        sum_.store(0, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+};
+
+}
\ No newline at end of file
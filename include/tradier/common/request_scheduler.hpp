@@ -0,0 +1,192 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace tradier {
+
+// Highest first
+enum class RequestPriority {
+    TRADING,    // order placement, changes and cancels
+    ACCOUNT,    // balances, positions, order status, user and watchlists
+    QUOTES,     // quotes, chains and the rest of the live market data
+    BULK        // history, timesales and fundamentals
+};
+
+// Admission control for requests: at most maxInFlight run at once, each
+// priority class has its own cap, and a freed slot goes to the highest
+// class with a waiter under its cap (FIFO within a class). Waiters that sit
+// in the queue past their class's maxQueueDelay are dropped instead of run.
+//
+// Callbacks run without the lock held, on the thread whose submit() or
+// release() made the decision.
+class RequestScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+    
+    static constexpr size_t CLASSES = 4;
+    static constexpr size_t UNLIMITED = std::numeric_limits<size_t>::max();
+
+private:
+    struct Waiter {
+        uint64_t id;
+        Clock::time_point deadline;
+        Callback start;
+        Callback drop;
+    };
+    
+    std::mutex mutex_;
+    std::array<std::deque<Waiter>, CLASSES> queues_;
+    std::array<size_t, CLASSES> running_{};
+    std::array<size_t, CLASSES> limits_;
+    std::array<std::chrono::milliseconds, CLASSES> maxQueueDelay_{};
+    size_t maxInFlight_;
+    size_t inFlight_ = 0;
+    uint64_t nextId_ = 1;
+    
+    // Collects the callbacks to run once the lock is released
+    void pump(std::vector<Callback>& ready) {
+        auto now = Clock::now();
+        for (auto& queue : queues_) {
+            for (auto it = queue.begin(); it != queue.end();) {
+                if (it->deadline <= now) {
+                    ready.push_back(std::move(it->drop));
+                    it = queue.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        
+        for (size_t level = 0; level < CLASSES && inFlight_ < maxInFlight_; ++level) {
+            auto& queue = queues_[level];
+            while (!queue.empty() && inFlight_ < maxInFlight_ && running_[level] < limits_[level]) {
+                ready.push_back(std::move(queue.front().start));
+                queue.pop_front();
+                running_[level]++;
+                inFlight_++;
+            }
+        }
+    }
+    
+    static void run(std::vector<Callback>& ready) {
+        for (auto& callback : ready) {
+            if (callback) {
+                callback();
+            }
+        }
+    }
+
+public:
+    explicit RequestScheduler(size_t maxInFlight = UNLIMITED) : maxInFlight_(std::max<size_t>(maxInFlight, 1)) {
+        limits_.fill(UNLIMITED);
+    }
+    
+    RequestScheduler(const RequestScheduler&) = delete;
+    RequestScheduler& operator=(const RequestScheduler&) = delete;
+    
+    // maxQueueDelay of zero never drops
+    void setLimits(RequestPriority priority, size_t maxInFlight, std::chrono::milliseconds maxQueueDelay) {
+        std::vector<Callback> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            limits_[static_cast<size_t>(priority)] = std::max<size_t>(maxInFlight, 1);
+            maxQueueDelay_[static_cast<size_t>(priority)] = maxQueueDelay;
+            pump(ready);
+        }
+        run(ready);
+    }
+    
+    void setMaxInFlight(size_t maxInFlight) {
+        std::vector<Callback> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            maxInFlight_ = std::max<size_t>(maxInFlight, 1);
+            pump(ready);
+        }
+        run(ready);
+    }
+    
+    // Queues a request; `start` runs once it holds a slot, which must then be
+    // given back with release(). Returns an id for cancel().
+    uint64_t submit(RequestPriority priority, Callback start, Callback drop) {
+        std::vector<Callback> ready;
+        uint64_t id = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto level = static_cast<size_t>(priority);
+            auto delay = maxQueueDelay_[level];
+            auto deadline = delay.count() > 0 ? Clock::now() + delay : Clock::time_point::max();
+            id = nextId_++;
+            queues_[level].push_back({id, deadline, std::move(start), std::move(drop)});
+            pump(ready);
+        }
+        run(ready);
+        return id;
+    }
+    
+    // Removes a waiter that has not started; false if it already started or
+    // was dropped
+    bool cancel(RequestPriority priority, uint64_t id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& queue = queues_[static_cast<size_t>(priority)];
+        auto it = std::find_if(queue.begin(), queue.end(), [id](const Waiter& waiter) { return waiter.id == id; });
+        if (it == queue.end()) {
+            return false;
+        }
+        queue.erase(it);
+        return true;
+    }
+    
+    void release(RequestPriority priority) {
+        std::vector<Callback> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto level = static_cast<size_t>(priority);
+            if (running_[level] > 0) {
+                running_[level]--;
+                inFlight_--;
+            }
+            pump(ready);
+        }
+        run(ready);
+    }
+    
+    std::chrono::milliseconds maxQueueDelay(RequestPriority priority) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return maxQueueDelay_[static_cast<size_t>(priority)];
+    }
+    
+    size_t running(RequestPriority priority) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return running_[static_cast<size_t>(priority)];
+    }
+    
+    size_t queued(RequestPriority priority) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queues_[static_cast<size_t>(priority)].size();
+    }
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include "tradier/common/types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace tradier {
+
+// Decoded results of slow-changing GETs, kept for a per-endpoint TTL and
+// revalidated afterwards with If-None-Match / If-Modified-Since when the
+// server sent an ETag or Last-Modified. Endpoints without a TTL are not
+// cached. Entries are charged by the size of the body they were decoded
+// from, and the least recently used are evicted beyond the memory cap.
+//
+// As with SingleFlight, keys must identify the value's type as well as the
+// request; callers pick the type when they read a value back.
+class ResponseCache {
+public:
+    using Value = std::shared_ptr<const void>;
+    using Clock = std::chrono::steady_clock;
+    
+    static constexpr size_t DEFAULT_MAX_BYTES = 32 * 1024 * 1024;
+    
+    // What lookup() found. A stale entry still carries its value, served
+    // again if the server answers the conditional request with 304.
+    struct Entry {
+        Value value;
+        std::string etag;
+        std::string lastModified;
+        size_t bytes = 0;
+        bool fresh = false;
+        
+        Headers conditionalHeaders() const {
+            Headers headers;
+            if (!etag.empty()) {
+                headers["If-None-Match"] = etag;
+            }
+            if (!lastModified.empty()) {
+                headers["If-Modified-Since"] = lastModified;
+            }
+            return headers;
+        }
+    };
+    
+    struct Statistics {
+        uint64_t hits = 0;           // fresh entries, served without a request
+        uint64_t stale = 0;          // expired entries sent for revalidation
+        uint64_t misses = 0;         // no entry
+        uint64_t notModified = 0;    // revalidations answered with 304
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
+private:
+    struct Node {
+        std::string key;
+        Value value;
+        std::string etag;
+        std::string lastModified;
+        size_t bytes = 0;
+        Clock::time_point expires;
+    };
+    
+    mutable std::mutex mutex_;
+    // Most recently used first
+    std::list<Node> lru_;
+    std::unordered_map<std::string, std::list<Node>::iterator> index_;
+    std::unordered_map<std::string, std::chrono::milliseconds> ttls_;
+    size_t maxBytes_;
+    size_t bytes_ = 0;
+    
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> stale_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> notModified_{0};
+    std::atomic<uint64_t> evictions_{0};
+    
+    static std::string header(const Headers& headers, std::string_view name) {
+        for (const auto& [key, value] : headers) {
+            bool matches = key.size() == name.size() &&
+                std::equal(key.begin(), key.end(), name.begin(), [](char a, char b) {
+                    return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+                });
+            if (matches) {
+                return value;
+            }
+        }
+        return {};
+    }
+    
+    void erase(std::list<Node>::iterator node) {
+        bytes_ -= node->bytes;
+        index_.erase(node->key);
+        lru_.erase(node);
+    }
+    
+    void insert(Node node) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto it = index_.find(node.key); it != index_.end()) {
+            erase(it->second);
+        }
+        if (node.bytes > maxBytes_) {
+            return;
+        }
+        
+        bytes_ += node.bytes;
+        lru_.push_front(std::move(node));
+        index_[lru_.front().key] = lru_.begin();
+        trim();
+    }
+    
+    void trim() {
+        while (bytes_ > maxBytes_ && !lru_.empty()) {
+            erase(std::prev(lru_.end()));
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    // Option expirations, strikes and lookups for five minutes, calendars,
+    // the ETB list and fundamentals for an hour
+    explicit ResponseCache(size_t maxBytes = DEFAULT_MAX_BYTES) : maxBytes_(maxBytes) {
+        using std::chrono::minutes;
+        for (const char* endpoint : {"/markets/options/expirations", "/markets/options/strikes", "/markets/options/lookup"}) {
+            ttls_[endpoint] = minutes(5);
+        }
+        for (const char* endpoint : {"/markets/calendar", "/markets/etb",
+                                     "/beta/markets/fundamentals/company", "/beta/markets/fundamentals/calendars",
+                                     "/beta/markets/fundamentals/dividends", "/beta/markets/fundamentals/corporate_actions",
+                                     "/beta/markets/fundamentals/ratios", "/beta/markets/fundamentals/financials"}) {
+            ttls_[endpoint] = minutes(60);
+        }
+    }
+    
+    ResponseCache(const ResponseCache&) = delete;
+    ResponseCache& operator=(const ResponseCache&) = delete;
+    
+    // A zero TTL stops caching the endpoint; existing entries age out
+    void setTtl(const std::string& endpoint, std::chrono::milliseconds ttl) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ttl.count() > 0) {
+            ttls_[endpoint] = ttl;
+        } else {
+            ttls_.erase(endpoint);
+        }
+    }
+    
+    std::chrono::milliseconds ttl(const std::string& endpoint) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = ttls_.find(endpoint);
+        return it == ttls_.end() ? std::chrono::milliseconds(0) : it->second;
+    }
+    
+    void setMaxBytes(size_t maxBytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        maxBytes_ = maxBytes;
+        trim();
+    }
+    
+    std::optional<Entry> lookup(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        
+        auto node = it->second;
+        lru_.splice(lru_.begin(), lru_, node);
+        bool fresh = Clock::now() < node->expires;
+        (fresh ? hits_ : stale_).fetch_add(1, std::memory_order_relaxed);
+        return Entry{node->value, node->etag, node->lastModified, node->bytes, fresh};
+    }
+    
+    // Caches a value decoded from a 2xx response of `bodyBytes` bytes,
+    // replacing any entry for the key. Values above the cap are not kept.
+    void store(const std::string& key, Value value, const Headers& responseHeaders, size_t bodyBytes,
+               std::chrono::milliseconds ttl) {
+        insert(Node{key, std::move(value), header(responseHeaders, "ETag"), header(responseHeaders, "Last-Modified"),
+                    bodyBytes + key.size() + sizeof(Node), Clock::now() + ttl});
+    }
+    
+    // The server answered a conditional request for `entry` with 304: keep
+    // the value for another TTL, taking any validators the 304 carried
+    void refresh(const std::string& key, const Entry& entry, const Headers& responseHeaders,
+                 std::chrono::milliseconds ttl) {
+        notModified_.fetch_add(1, std::memory_order_relaxed);
+        
+        auto etag = header(responseHeaders, "ETag");
+        auto lastModified = header(responseHeaders, "Last-Modified");
+        insert(Node{key, entry.value, etag.empty() ? entry.etag : std::move(etag),
+                    lastModified.empty() ? entry.lastModified : std::move(lastModified),
+                    entry.bytes, Clock::now() + ttl});
+    }
+    
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lru_.clear();
+        index_.clear();
+        bytes_ = 0;
+    }
+    
+    Statistics statistics() const {
+        Statistics stats;
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.stale = stale_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.notModified = notModified_.load(std::memory_order_relaxed);
+        stats.evictions = evictions_.load(std::memory_order_relaxed);
+        
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats.entries = index_.size();
+        stats.bytes = bytes_;
+        return stats;
+    }
+};
+
+}
\ No newline at end of file
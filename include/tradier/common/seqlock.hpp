@@ -0,0 +1,96 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace tradier {
+
+// Single-writer sequence lock around a trivially copyable value. The writer
+// never waits; readers retry while a write is in flight, so a read costs a
+// few loads unless it collides with a store. The value is kept as relaxed
+// atomic words so torn reads are detected rather than undefined.
+template<typename T>
+class Seqlock {
+private:
+    static_assert(std::is_trivially_copyable_v<T>, "Seqlock values must be trivially copyable");
+    
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    
+    std::atomic<uint64_t> sequence_{0};
+    std::atomic<uint64_t> words_[WORDS] = {};
+    
+    void copyOut(uint64_t* buffer) const {
+        for (size_t i = 0; i < WORDS; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+public:
+    Seqlock() = default;
+    Seqlock(const Seqlock&) = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+    
+    // Writer side; calls for one Seqlock must not overlap
+    void store(const T& value) {
+        uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+    
+    // Read-modify-write from the writer thread, which needs no retry loop
+    template<typename Update>
+    void update(Update&& update) {
+        uint64_t buffer[WORDS];
+        copyOut(buffer);
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        update(value);
+        store(value);
+    }
+    
+    T load() const {
+        uint64_t buffer[WORDS];
+        for (;;) {
+            uint64_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;
+            }
+            copyOut(buffer);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+    
+    // Number of completed stores
+    uint64_t version() const {
+        return sequence_.load(std::memory_order_acquire) / 2;
+    }
+};
+
+}
\ No newline at end of file
@@ -8,31 +8,32 @@
 #include <future>
 #include <functional>
 #include "tradier/common/api_result.hpp"
+#include "tradier/common/async.hpp"
 
 namespace tradier {
 
-// Simple async wrapper using std::async
+// Simple async wrapper over the blocking ThreadPool: syncFunc is a
+// synchronous API call, so it must not occupy the shared pool that decodes
+// async market data replies
 template<typename T>
 using SimpleAsyncResult = std::future<ApiResult<T>>;
 
 template<typename T>
 using SimpleAsyncCallback = std::function<void(const ApiResult<T>&)>;
 
-// Simple async execution using std::async
+// Pooled rather than std::async: no thread spawn per call, and no blocking
+// destructor on a discarded future
 template<typename T>
 SimpleAsyncResult<T> makeSimpleAsync(std::function<ApiResult<T>()> syncFunc) {
-    return std::async(std::launch::async, std::move(syncFunc));
+    return ThreadPool::getBlockingInstance().enqueue(std::move(syncFunc));
 }
 
 // Simple callback-based async execution
 template<typename T>
 void executeSimpleAsync(std::function<ApiResult<T>()> syncFunc, SimpleAsyncCallback<T> callback) {
-    auto future = makeSimpleAsync<T>(std::move(syncFunc));
-    
-    // Launch another async task to handle the callback
-    std::async(std::launch::async, [future = std::move(future), callback = std::move(callback)]() mutable {
+    ThreadPool::getBlockingInstance().enqueue([syncFunc = std::move(syncFunc), callback = std::move(callback)]() {
         try {
-            auto result = future.get();
+            auto result = syncFunc();
             callback(result);
         } catch (const std::exception& e) {
             callback(ApiResult<T>::internalError(e.what()));
@@ -0,0 +1,134 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tradier {
+
+// Deduplicates identical work that is in flight at the same time: the first
+// caller for a key (the leader) produces the value, and everyone who joins
+// the key before it finishes receives that same value or exception. Nothing
+// is kept once a flight completes, so this never serves stale data.
+//
+// Keys must identify the value's type as well as the request; callers pick
+// the type when they read the shared value back.
+class SingleFlight {
+public:
+    using Value = std::shared_ptr<const void>;
+    using Callback = std::function<void(const Value&, std::exception_ptr)>;
+    
+    struct Statistics {
+        uint64_t leaders = 0;
+        uint64_t coalesced = 0;
+    };
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::vector<Callback>> flights_;
+    std::atomic<uint64_t> leaders_{0};
+    std::atomic<uint64_t> coalesced_{0};
+
+public:
+    SingleFlight() = default;
+    SingleFlight(const SingleFlight&) = delete;
+    SingleFlight& operator=(const SingleFlight&) = delete;
+    
+    // Registers a waiter for `key`. Returns true if the caller became the
+    // leader and must finish the flight with complete().
+    bool join(const std::string& key, Callback callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto [it, leader] = flights_.try_emplace(key);
+        it->second.push_back(std::move(callback));
+        (leader ? leaders_ : coalesced_).fetch_add(1, std::memory_order_relaxed);
+        return leader;
+    }
+    
+    // Ends the flight and runs every waiter's callback, including the
+    // leader's, on the calling thread. A callback that throws is skipped
+    // over, so the waiters after it are still released
+    void complete(const std::string& key, Value value, std::exception_ptr error) {
+        std::vector<Callback> waiters;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = flights_.find(key);
+            if (it == flights_.end()) {
+                return;
+            }
+            waiters = std::move(it->second);
+            flights_.erase(it);
+        }
+        
+        for (auto& waiter : waiters) {
+            try {
+                waiter(value, error);
+            } catch (...) {
+            }
+        }
+    }
+    
+    // Blocking form: runs `produce` if no identical flight is under way,
+    // otherwise waits for that flight's result. `produce` returns a T, or a
+    // std::shared_ptr<const T> that is shared as is
+    template<typename T, typename F>
+    std::shared_ptr<const T> run(const std::string& key, F&& produce) {
+        auto promise = std::make_shared<std::promise<Value>>();
+        auto future = promise->get_future();
+        
+        bool leader = join(key, [promise](const Value& value, std::exception_ptr error) {
+            if (error) {
+                promise->set_exception(error);
+            } else {
+                promise->set_value(value);
+            }
+        });
+        
+        if (leader) {
+            Value value;
+            std::exception_ptr error;
+            try {
+                if constexpr (std::is_same_v<std::invoke_result_t<F&>, std::shared_ptr<const T>>) {
+                    value = produce();
+                } else {
+                    value = std::make_shared<const T>(produce());
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+            complete(key, std::move(value), error);
+        }
+        
+        return std::static_pointer_cast<const T>(future.get());
+    }
+    
+    size_t inFlight() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return flights_.size();
+    }
+    
+    Statistics statistics() const {
+        return {leaders_.load(std::memory_order_relaxed), coalesced_.load(std::memory_order_relaxed)};
+    }
+};
+
+}
\ No newline at end of file
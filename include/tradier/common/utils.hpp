@@ -12,7 +12,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <sstream>
 #include <iomanip>
 
@@ -42,20 +45,80 @@ inline std::string formatDate(const TimePoint& timePoint) {
     return ss.str();
 }
 
-inline std::string urlEncode(const std::string& value) {
-    std::ostringstream encoded;
-    encoded.fill('0');
-    encoded << std::hex;
-    
+namespace detail {
+
+// Encoded width of each byte: 1 for RFC 3986 unreserved characters, else 3
+inline constexpr std::array<uint8_t, 256> URL_ENCODED_WIDTH = [] {
+    std::array<uint8_t, 256> width{};
+    for (int c = 0; c < 256; ++c) {
+        bool unreserved = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                          c == '-' || c == '_' || c == '.' || c == '~';
+        width[c] = unreserved ? 1 : 3;
+    }
+    return width;
+}();
+
+inline size_t urlEncodedLength(std::string_view value) {
+    size_t length = 0;
+    for (unsigned char c : value) {
+        length += URL_ENCODED_WIDTH[c];
+    }
+    return length;
+}
+
+inline char* writeUrlEncoded(char* out, std::string_view value) {
+    static constexpr char HEX[] = "0123456789ABCDEF";
     for (unsigned char c : value) {
-        if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
-            encoded << c;
+        if (URL_ENCODED_WIDTH[c] == 1) {
+            *out++ = static_cast<char>(c);
         } else {
-            encoded << '%' << std::setw(2) << static_cast<int>(c);
+            out[0] = '%';
+            out[1] = HEX[c >> 4];
+            out[2] = HEX[c & 0xF];
+            out += 3;
         }
     }
+    return out;
+}
+
+}
+
+// Percent-encodes `value` onto the end of `out`
+inline void appendUrlEncoded(std::string& out, std::string_view value) {
+    size_t offset = out.size();
+    out.resize(offset + detail::urlEncodedLength(value));
+    detail::writeUrlEncoded(out.data() + offset, value);
+}
+
+inline std::string urlEncode(std::string_view value) {
+    std::string encoded;
+    appendUrlEncoded(encoded, value);
+    return encoded;
+}
+
+// Appends key=value pairs joined by '&', as used for both query strings and
+// application/x-www-form-urlencoded bodies, sizing `out` once up front
+template<typename Params>
+void appendUrlEncodedParams(std::string& out, const Params& params) {
+    size_t length = 0;
+    for (const auto& [key, value] : params) {
+        length += detail::urlEncodedLength(key) + detail::urlEncodedLength(value) + 2;
+    }
+    if (length == 0) {
+        return;
+    }
     
-    return encoded.str();
+    size_t offset = out.size();
+    out.resize(offset + length - 1);
+    char* cursor = out.data() + offset;
+    for (const auto& [key, value] : params) {
+        if (cursor != out.data() + offset) {
+            *cursor++ = '&';
+        }
+        cursor = detail::writeUrlEncoded(cursor, key);
+        *cursor++ = '=';
+        cursor = detail::writeUrlEncoded(cursor, value);
+    }
 }
 
 template<typename T>
@@ -22,7 +22,9 @@ namespace tradier {
 
 class WebSocketImpl;
 
-using MessageCallback = std::function<void(const std::string&)>;
+// The view points into the connection's receive buffer and is only valid
+// for the duration of the call; copy it to keep the payload
+using MessageCallback = std::function<void(std::string_view)>;
 
 class WebSocketConnection {
 private:
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <string_view>
 #include <nlohmann/json.hpp>
 #include "tradier/market.hpp"
 
@@ -22,6 +23,8 @@ Quote parseQuote(const nlohmann::json& json);
 std::vector<Quote> parseQuotes(const nlohmann::json& json);
 OptionChain parseOptionChain(const nlohmann::json& json);
 std::vector<OptionChain> parseOptionChains(const nlohmann::json& json);
+// SAX pass over the raw body; throws std::runtime_error on malformed JSON
+OptionChainColumns parseOptionChainColumns(std::string_view body);
 std::vector<double> parseStrikes(const nlohmann::json& json);
 Expiration parseExpiration(const nlohmann::json& json);
 std::vector<Expiration> parseExpirations(const nlohmann::json& json);
@@ -33,6 +36,11 @@ TimeSalesData parseTimeSalesData(const nlohmann::json& json);
 std::vector<TimeSalesData> parseTimeSalesList(const nlohmann::json& json);
 Security parseSecurity(const nlohmann::json& json);
 std::vector<Security> parseSecurities(const nlohmann::json& json);
+// One row as raw JSON text, read with a SAX pass instead of a DOM; throws
+// std::runtime_error on malformed JSON
+HistoricalData parseHistoricalDataRow(std::string_view row);
+TimeSalesData parseTimeSalesRow(std::string_view row);
+Security parseSecurityRow(std::string_view row);
 SessionTime parseSessionTime(const nlohmann::json& json);
 MarketDay parseMarketDay(const nlohmann::json& json);
 MarketCalendar parseMarketCalendar(const nlohmann::json& json);
@@ -0,0 +1,72 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tradier {
+namespace json {
+
+// Push splitter for a JSON document that arrives in arbitrary chunks. It
+// follows the object keys in `path` from the root and hands each object in
+// the array found there (or the value itself when the API sends a lone
+// object) to the handler as soon as its closing brace arrives. Only the
+// record in progress is buffered; everything off the path is skipped.
+//
+// Tradier's list endpoints wrap their rows this way, e.g. path
+// {"history", "day"} for {"history": {"day": [{...}, {...}]}}.
+class RecordStream {
+public:
+    using RecordHandler = std::function<void(std::string_view record)>;
+    
+    RecordStream(std::vector<std::string> path, RecordHandler onRecord);
+    
+    // Throws std::runtime_error on mismatched brackets or trailing content
+    void feed(std::string_view chunk);
+    
+    // Throws std::runtime_error if the document has not been closed
+    void finish() const;
+    
+    size_t records() const { return records_; }
+
+private:
+    struct Frame {
+        bool object;
+        bool expectKey;
+        bool keyMatched;
+        bool target;    // the array holding the records
+        int level;      // index into path_ for this object's keys, or -1
+    };
+    
+    void open(char c, size_t position, size_t& captureFrom);
+    void close(char c, std::string_view chunk, size_t position, size_t& captureFrom);
+    
+    std::vector<std::string> path_;
+    RecordHandler onRecord_;
+    std::vector<Frame> stack_;
+    std::string key_;
+    std::string record_;
+    size_t recordDepth_ = 0;
+    size_t records_ = 0;
+    bool inString_ = false;
+    bool escape_ = false;
+    bool capturingKey_ = false;
+    bool started_ = false;
+    bool done_ = false;
+};
+
+}
+}
\ No newline at end of file
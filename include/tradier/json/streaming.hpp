@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <string_view>
 #include <nlohmann/json.hpp>
 #include "tradier/streaming.hpp"
 
@@ -19,5 +20,45 @@ namespace json {
 
 StreamSession parseStreamSession(const nlohmann::json& json);
 
+enum class StreamDecodeStatus {
+    TRADE,
+    QUOTE,
+    SUMMARY,
+    TIMESALE,
+    IGNORED,      // well-formed, but not a market event type decoded here
+    UNSUPPORTED   // escapes, nesting, bad types or malformed input
+};
+
+// Reused across messages so the string members keep their capacity.
+// Only the event matching the returned status is meaningful.
+struct StreamEventBuffer {
+    TradeEvent trade;
+    QuoteEvent quote;
+    SummaryEvent summary;
+    TimesaleEvent timesale;
+    std::string exchange;
+    bool hasExchange = false;
+};
+
+// Compact events plus views of the frame's symbol and exchange for filtering;
+// the views point into the decoded message
+struct CompactEventBuffer {
+    CompactTradeEvent trade;
+    CompactQuoteEvent quote;
+    CompactTimesaleEvent timesale;
+    std::string_view symbol;
+    std::string_view exchange;
+    bool hasExchange = false;
+};
+
+// Single forward pass over a flat stream frame with from_chars numerics and
+// no DOM. Field semantics match the nlohmann path in StreamingService; on
+// UNSUPPORTED the caller should fall back to a full parse.
+StreamDecodeStatus decodeStreamEvent(std::string_view message, StreamEventBuffer& out);
+
+// Same scan, filling compact events and interning the symbol. Summary
+// frames report IGNORED.
+StreamDecodeStatus decodeCompactStreamEvent(std::string_view message, SymbolTable& symbols, CompactEventBuffer& out);
+
 } // namespace json
 } // namespace tradier
\ No newline at end of file
@@ -13,8 +13,11 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <optional>
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include "tradier/common/types.hpp"
 #include "tradier/common/api_result.hpp"
 #include "tradier/common/simple_async.hpp"
@@ -116,6 +119,69 @@ struct OptionChain {
     std::optional<Greeks> greeks;
 };
 
+enum class OptionRight : uint8_t {
+    UNKNOWN,
+    CALL,
+    PUT
+};
+
+// Structure-of-arrays option chain: row i of every column describes the same
+// contract. Built straight from the response text without a DOM or
+// per-contract allocations; symbols share one string pool.
+struct OptionChainColumns {
+    // Bits in `validity`; columns without a bit are always populated
+    enum Field : uint8_t {
+        HAS_LAST = 1 << 0,
+        HAS_CHANGE = 1 << 1,
+        HAS_GREEKS = 1 << 2
+    };
+    
+    std::vector<double> strike;
+    std::vector<double> bid;
+    std::vector<double> ask;
+    std::vector<double> last;
+    std::vector<double> change;
+    std::vector<int32_t> volume;
+    std::vector<int32_t> openInterest;
+    std::vector<int32_t> bidSize;
+    std::vector<int32_t> askSize;
+    std::vector<int32_t> contractSize;
+    std::vector<OptionRight> right;
+    
+    std::vector<double> delta;
+    std::vector<double> gamma;
+    std::vector<double> theta;
+    std::vector<double> vega;
+    std::vector<double> rho;
+    std::vector<double> bidIv;
+    std::vector<double> midIv;
+    std::vector<double> askIv;
+    std::vector<double> smvVol;
+    
+    std::vector<uint8_t> validity;
+    
+    std::string symbolPool;
+    std::vector<uint32_t> symbolOffsets;    // size() + 1 entries
+    
+    // Chain-level; a chain request covers one underlying and expiration
+    std::string underlying;
+    std::string expirationDate;
+    
+    size_t size() const { return strike.size(); }
+    bool empty() const { return strike.empty(); }
+    
+    bool valid(size_t row, Field field) const {
+        return (validity[row] & field) != 0;
+    }
+    
+    std::string_view symbol(size_t row) const {
+        return std::string_view(symbolPool).substr(symbolOffsets[row], symbolOffsets[row + 1] - symbolOffsets[row]);
+    }
+    
+    void reserve(size_t rows);
+    void clear();
+};
+
 struct Strike {
     double value;
 };
@@ -387,6 +453,7 @@ public:
     Result<Quote> getQuote(const std::string& symbol, bool greeks = false);
 
     Result<std::vector<OptionChain>> getOptionChain(const std::string& symbol, const std::string& expiration, bool greeks = false);
+    Result<OptionChainColumns> getOptionChainColumns(const std::string& symbol, const std::string& expiration, bool greeks = false);
     Result<std::vector<double>> getOptionStrikes(const std::string& symbol, const std::string& expiration, bool includeAllRoots = false);
     Result<std::vector<Expiration>> getOptionExpirations(const std::string& symbol, bool includeAllRoots = false, bool strikes = false, bool contractSize = false, bool expirationType = false);
     Result<std::vector<OptionSymbol>> lookupOptionSymbols(const std::string& underlying);
@@ -395,6 +462,14 @@ public:
     Result<std::vector<TimeSalesData>> getTimeSales(const std::string& symbol, const std::string& interval = "1min", const std::string& start = "", const std::string& end = "", const std::string& sessionFilter = "all");
 
     Result<std::vector<Security>> getETBList();
+
+    // Streaming variants for large responses: each row is parsed and passed
+    // to `onRow` while the rest of the body is still downloading, so only one
+    // row is held at a time. `onRow` runs on the transferring thread; an
+    // exception it throws aborts the request. The result is the row count.
+    Result<size_t> streamHistoricalData(const std::string& symbol, std::function<void(const HistoricalData&)> onRow, const std::string& interval = "daily", const std::string& start = "", const std::string& end = "", const std::string& sessionFilter = "all");
+    Result<size_t> streamTimeSales(const std::string& symbol, std::function<void(const TimeSalesData&)> onRow, const std::string& interval = "1min", const std::string& start = "", const std::string& end = "", const std::string& sessionFilter = "all");
+    Result<size_t> streamETBList(std::function<void(const Security&)> onRow);
     Result<MarketClock> getClock(bool delayed = false);
     Result<MarketCalendar> getCalendar(const std::string& month = "", const std::string& year = "");
     Result<std::vector<Security>> searchSymbols(const std::string& query, bool indexes = true);
@@ -414,6 +489,7 @@ public:
     SimpleAsyncResult<Quote> getQuoteAsync(const std::string& symbol, bool greeks = false);
 
     SimpleAsyncResult<std::vector<OptionChain>> getOptionChainAsync(const std::string& symbol, const std::string& expiration, bool greeks = false);
+    SimpleAsyncResult<OptionChainColumns> getOptionChainColumnsAsync(const std::string& symbol, const std::string& expiration, bool greeks = false);
     SimpleAsyncResult<std::vector<double>> getOptionStrikesAsync(const std::string& symbol, const std::string& expiration, bool includeAllRoots = false);
     SimpleAsyncResult<std::vector<Expiration>> getOptionExpirationsAsync(const std::string& symbol, bool includeAllRoots = false, bool strikes = false, bool contractSize = false, bool expirationType = false);
     SimpleAsyncResult<std::vector<OptionSymbol>> lookupOptionSymbolsAsync(const std::string& underlying);
@@ -0,0 +1,94 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include "tradier/common/seqlock.hpp"
+#include "tradier/streaming.hpp"
+
+namespace tradier {
+
+// Top of book and last sale for one symbol. Times are epoch milliseconds and
+// cumulativeVolume is the feed's cvol from the latest trade.
+struct MarketState {
+    double bid = 0.0;
+    double ask = 0.0;
+    int64_t bidTimeMs = 0;
+    int64_t askTimeMs = 0;
+    int32_t bidSize = 0;
+    int32_t askSize = 0;
+    
+    double lastPrice = 0.0;
+    int64_t lastTimeMs = 0;
+    int64_t cumulativeVolume = 0;
+    int32_t lastSize = 0;
+    
+    uint32_t quoteUpdates = 0;
+    uint32_t tradeUpdates = 0;
+    char bidExchange = '\0';
+    char askExchange = '\0';
+    char lastExchange = '\0';
+    
+    bool hasQuote() const { return quoteUpdates > 0; }
+    bool hasTrade() const { return tradeUpdates > 0; }
+    double mid() const { return (bid + ask) * 0.5; }
+};
+
+// Per-symbol MarketState in a flat table indexed by SymbolId, one cache-line
+// aligned seqlock row per symbol. Rows are allocated in blocks on first use
+// and never move, so readers on any thread take snapshots without locks
+// while the stream's read thread applies events in place. Each symbol must
+// have a single writer, which the streaming services guarantee.
+class MarketStateCache {
+private:
+    static constexpr size_t BLOCK_ROWS = 256;
+    
+    struct alignas(64) Row {
+        Seqlock<MarketState> state;
+    };
+    
+    std::shared_ptr<const SymbolTable> symbols_;
+    std::unique_ptr<std::atomic<Row*>[]> blocks_;
+    size_t blockCount_;
+    std::atomic<uint64_t> rejected_{0};
+    
+    Row* writableRow(SymbolId id);
+    const Row* findRow(SymbolId id) const;
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = size_t{1} << 20;
+    
+    // Events for ids at or beyond capacity are counted in rejected() and dropped
+    explicit MarketStateCache(std::shared_ptr<const SymbolTable> symbols, size_t capacity = DEFAULT_CAPACITY);
+    ~MarketStateCache();
+    
+    MarketStateCache(const MarketStateCache&) = delete;
+    MarketStateCache& operator=(const MarketStateCache&) = delete;
+    
+    void apply(const CompactQuoteEvent& event);
+    void apply(const CompactTradeEvent& event);
+    
+    // False when the symbol has not been updated yet
+    bool snapshot(SymbolId id, MarketState& out) const;
+    std::optional<MarketState> snapshot(std::string_view symbol) const;
+    
+    size_t capacity() const;
+    uint64_t rejected() const;
+    const SymbolTable& symbols() const;
+};
+
+}
\ No newline at end of file
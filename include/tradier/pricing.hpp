@@ -0,0 +1,67 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+ 
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "tradier/market.hpp"
+#include "tradier/simd/black_scholes.hpp"
+
+namespace tradier {
+
+struct QuoteEvent;
+
+struct PricingParameters {
+    simd::pricing::model model = simd::pricing::model::black_scholes;
+    double rate = 0.0;
+    double dividendYield = 0.0;
+};
+
+// Keeps one expiration's implied volatilities and greeks current from
+// streaming quotes. applyQuote only records prices; refresh() solves and
+// reprices the whole chain in one batched pass through the SIMD kernels.
+// Not thread-safe: feed and refresh from a single thread.
+class OptionChainPricer {
+private:
+    OptionChainColumns chain_;
+    std::unordered_map<std::string, size_t> rows_;
+    std::vector<double> expiry_;
+    std::vector<double> mid_;
+    PricingParameters parameters_;
+    double underlyingPrice_ = 0.0;
+    
+    void indexRows();
+
+public:
+    OptionChainPricer(OptionChainColumns chain, double expiryYears, PricingParameters parameters = {});
+    OptionChainPricer(const std::vector<OptionChain>& chain, double expiryYears, PricingParameters parameters = {});
+    
+    // Quotes for the chain's underlying set the underlying price (mid);
+    // quotes for its contracts set their bid and ask. Returns false for
+    // symbols that belong to neither.
+    bool applyQuote(const QuoteEvent& quote);
+    
+    void setUnderlyingPrice(double price) { underlyingPrice_ = price; }
+    void setExpiryYears(double years);
+    void setParameters(const PricingParameters& parameters) { parameters_ = parameters; }
+    
+    // Solves mid implied volatility per contract into midIv, then fills
+    // delta, gamma, theta, vega and rho at that volatility. Contracts whose
+    // mid cannot be solved lose HAS_GREEKS. Returns the number priced.
+    size_t refresh();
+    
+    double underlyingPrice() const { return underlyingPrice_; }
+    const OptionChainColumns& chain() const { return chain_; }
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+/*
+ * SIMD Black-Scholes / Black-76 Pricing
+ *
+ * Batched European option pricing, greeks and implied volatility over
+ * columnar contract data. The scalar variant uses the C library's exp, log
+ * and erfc; the AVX2 and AVX-512 variants use polynomial approximations that
+ * agree with it to roughly 1e-13 relative.
+ */
+
+#include "simd_traits.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace tradier {
+
+enum class OptionRight : uint8_t;
+
+namespace simd {
+namespace pricing {
+
+enum class model : uint8_t {
+    black_scholes,    // spot underlying with a continuous dividend yield
+    black76           // forward underlying (futures options)
+};
+
+struct market {
+    model kind = model::black_scholes;
+    double underlying = 0.0;        // spot, or the forward for black76
+    double rate = 0.0;              // continuously compounded
+    double dividend_yield = 0.0;    // ignored for black76
+};
+
+// Columnar contract description; every array holds `count` rows. Rows with
+// OptionRight::UNKNOWN are priced as calls.
+struct contracts {
+    const double* strike = nullptr;
+    const double* expiry = nullptr;     // years to expiration
+    const OptionRight* right = nullptr;
+    size_t count = 0;
+};
+
+// Outputs to fill; null pointers are skipped. Greeks follow the API's units:
+// theta per calendar day, vega and rho per 1% move.
+struct outputs {
+    double* price = nullptr;
+    double* delta = nullptr;
+    double* gamma = nullptr;
+    double* theta = nullptr;
+    double* vega = nullptr;
+    double* rho = nullptr;
+};
+
+struct solver_settings {
+    double tolerance = 1e-9;        // absolute price error
+    int max_iterations = 100;
+    double max_volatility = 10.0;
+};
+
+struct price_impl {
+    static void scalar(const market& mkt, const contracts& rows, const double* volatility, const outputs& out);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static void avx2(const market& mkt, const contracts& rows, const double* volatility,
+                                                 const outputs& out);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static void avx512(const market& mkt, const contracts& rows, const double* volatility,
+                                                     const outputs& out);
+#endif
+};
+
+struct implied_volatility_impl {
+    static size_t scalar(const market& mkt, const contracts& rows, const double* price, double* volatility,
+                         const solver_settings& settings);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static size_t avx2(const market& mkt, const contracts& rows, const double* price,
+                                                   double* volatility, const solver_settings& settings);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static size_t avx512(const market& mkt, const contracts& rows, const double* price,
+                                                       double* volatility, const solver_settings& settings);
+#endif
+};
+
+/**
+ * @brief Prices every row at the given volatility and fills the requested greeks
+ *
+ * Rows with no time or volatility left are worth their discounted intrinsic
+ * value, with delta 0 or +/-1 (discounted) and every other greek 0.
+ */
+void price(const market& mkt, const contracts& rows, const double* volatility, const outputs& out);
+
+/**
+ * @brief Solves for the volatility reproducing each row's price
+ *
+ * Newton steps on vega inside a bisection bracket, so every row either
+ * converges or ends as NaN. Prices outside the no-arbitrage bounds, or rows
+ * without time to expiration, yield NaN.
+ *
+ * @return Number of rows that converged
+ */
+size_t implied_volatility(const market& mkt, const contracts& rows, const double* price, double* volatility,
+                          const solver_settings& settings = {});
+
+} // namespace pricing
+} // namespace simd
+} // namespace tradier
\ No newline at end of file
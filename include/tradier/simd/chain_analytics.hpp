@@ -0,0 +1,140 @@
+#pragma once
+
+/*
+ * SIMD Option Chain Analytics
+ *
+ * Chain-wide kernels over the columns of OptionChainColumns. Each kernel has
+ * scalar, AVX2 and AVX-512 implementations, picked per call from active_isa(),
+ * that produce the same element-wise results (sums may differ in the last
+ * bits from reordering).
+ */
+
+#include "simd_traits.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace tradier {
+
+struct OptionChainColumns;
+
+namespace simd {
+namespace chain {
+
+// Dollar exposures for a chain held at open interest. Delta is per $1 move of
+// the underlying, gamma is the change in dollar delta per 1% move.
+struct greek_exposure {
+    double dollar_delta = 0.0;
+    double dollar_gamma = 0.0;
+};
+
+struct mid_price_impl {
+    static void scalar(const double* bid, const double* ask, double* out, size_t count);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static void avx2(const double* bid, const double* ask, double* out, size_t count);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static void avx512(const double* bid, const double* ask, double* out, size_t count);
+#endif
+};
+
+struct relative_spread_impl {
+    static void scalar(const double* bid, const double* ask, double* out, size_t count);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static void avx2(const double* bid, const double* ask, double* out, size_t count);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static void avx512(const double* bid, const double* ask, double* out, size_t count);
+#endif
+};
+
+struct moneyness_impl {
+    static void scalar(const double* strike, double underlying, double* out, size_t count);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static void avx2(const double* strike, double underlying, double* out, size_t count);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static void avx512(const double* strike, double underlying, double* out, size_t count);
+#endif
+};
+
+struct greek_exposure_impl {
+    static greek_exposure scalar(const double* delta, const double* gamma, const int32_t* open_interest,
+                                 const int32_t* contract_size, double underlying, size_t count);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static greek_exposure avx2(const double* delta, const double* gamma, const int32_t* open_interest,
+                                                           const int32_t* contract_size, double underlying, size_t count);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static greek_exposure avx512(const double* delta, const double* gamma, const int32_t* open_interest,
+                                                               const int32_t* contract_size, double underlying, size_t count);
+#endif
+};
+
+struct range_mask_impl {
+    static size_t scalar(const double* values, double low, double high, uint8_t* mask, size_t count);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static size_t avx2(const double* values, double low, double high, uint8_t* mask, size_t count);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static size_t avx512(const double* values, double low, double high, uint8_t* mask, size_t count);
+#endif
+};
+
+struct abs_range_mask_impl {
+    static size_t scalar(const double* values, double low, double high, uint8_t* mask, size_t count);
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX2 static size_t avx2(const double* values, double low, double high, uint8_t* mask, size_t count);
+#endif
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+    LIBTRADIER_SIMD_TARGET_AVX512 static size_t avx512(const double* values, double low, double high, uint8_t* mask, size_t count);
+#endif
+};
+
+/**
+ * @brief (bid + ask) / 2 for each row
+ */
+void mid_price(const double* bid, const double* ask, double* out, size_t count);
+
+/**
+ * @brief (ask - bid) / mid for each row; NaN where the mid is not positive
+ */
+void relative_spread(const double* bid, const double* ask, double* out, size_t count);
+
+/**
+ * @brief strike / underlying for each row (below 1 is in the money for calls)
+ */
+void moneyness(const double* strike, double underlying, double* out, size_t count);
+
+/**
+ * @brief Sums delta * OI * contract size * S and gamma * OI * contract size * S^2 / 100
+ */
+greek_exposure greek_exposure_sum(const double* delta, const double* gamma, const int32_t* open_interest,
+                                  const int32_t* contract_size, double underlying, size_t count);
+
+/**
+ * @brief Sets mask[i] to 1 where low <= values[i] <= high, else 0
+ *
+ * @return Number of rows selected
+ */
+size_t range_mask(const double* values, double low, double high, uint8_t* mask, size_t count);
+
+/**
+ * @brief Sets mask[i] to 1 where low <= |values[i]| <= high, else 0
+ *
+ * Selects a delta band across calls and puts alike.
+ *
+ * @return Number of rows selected
+ */
+size_t abs_range_mask(const double* values, double low, double high, uint8_t* mask, size_t count);
+
+// Whole-chain conveniences; output buffers must hold columns.size() entries
+void mid_price(const OptionChainColumns& columns, double* out);
+void relative_spread(const OptionChainColumns& columns, double* out);
+void moneyness(const OptionChainColumns& columns, double underlying, double* out);
+greek_exposure greek_exposure_sum(const OptionChainColumns& columns, double underlying);
+size_t strike_range_mask(const OptionChainColumns& columns, double low, double high, uint8_t* mask);
+size_t delta_band_mask(const OptionChainColumns& columns, double low, double high, uint8_t* mask);
+
+} // namespace chain
+} // namespace simd
+} // namespace tradier
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+/*
+ * SIMD Runtime CPU Feature Selection
+ *
+ * Detects the instruction sets the host CPU and OS support and records which
+ * kernel variant simd_dispatcher uses. Detection runs once, on first use; the
+ * LIBTRADIER_SIMD_ISA environment variable (scalar, avx2, avx512) can lower
+ * the choice for a process, and select_isa() can change it at runtime.
+ */
+
+#include <cstdint>
+
+namespace tradier {
+namespace simd {
+
+enum class isa : uint8_t {
+    scalar = 0,
+    avx2 = 1,     // AVX2 + FMA
+    avx512 = 2    // AVX-512 F + DQ
+};
+
+/**
+ * @brief Best variant this build can run on this host
+ */
+isa detected_isa();
+
+/**
+ * @brief Variant the kernels currently dispatch to
+ */
+isa active_isa();
+
+/**
+ * @brief Switches the dispatched variant, capped at detected_isa()
+ *
+ * @return The variant actually selected
+ */
+isa select_isa(isa requested);
+
+const char* isa_name(isa value);
+
+} // namespace simd
+} // namespace tradier
\ No newline at end of file
@@ -7,19 +7,39 @@
  * It includes proper feature detection and fallback mechanisms.
  */
 
-// SIMD availability detection
-#ifdef __AVX2__
+// Runtime dispatch: on x86 with GCC/Clang every variant is compiled into the
+// binary with per-function target attributes and chosen from CPUID at runtime.
+// Define LIBTRADIER_SIMD_RUNTIME_DISPATCH=0 for compile-time selection only.
+#ifndef LIBTRADIER_SIMD_RUNTIME_DISPATCH
+    #if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+        #define LIBTRADIER_SIMD_RUNTIME_DISPATCH 1
+    #else
+        #define LIBTRADIER_SIMD_RUNTIME_DISPATCH 0
+    #endif
+#endif
+
+// SIMD availability detection (variant compiled in, not necessarily usable)
+#if defined(__AVX2__) || LIBTRADIER_SIMD_RUNTIME_DISPATCH
     #define LIBTRADIER_SIMD_AVX2_AVAILABLE 1
 #else
     #define LIBTRADIER_SIMD_AVX2_AVAILABLE 0
 #endif
 
-#ifdef __AVX512F__
+#if defined(__AVX512F__) || LIBTRADIER_SIMD_RUNTIME_DISPATCH
     #define LIBTRADIER_SIMD_AVX512_AVAILABLE 1
 #else
     #define LIBTRADIER_SIMD_AVX512_AVAILABLE 0
 #endif
 
+// Variant attributes; needed on both the declaration and the definition
+#if LIBTRADIER_SIMD_RUNTIME_DISPATCH
+    #define LIBTRADIER_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #define LIBTRADIER_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512dq")))
+#else
+    #define LIBTRADIER_SIMD_TARGET_AVX2
+    #define LIBTRADIER_SIMD_TARGET_AVX512
+#endif
+
 // SIMD configuration
 #ifndef LIBTRADIER_SIMD_ENABLED
     #define LIBTRADIER_SIMD_ENABLED 0
@@ -7,6 +7,7 @@
  */
 
 #include "simd_config.hpp"
+#include "cpu_features.hpp"
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -38,7 +39,16 @@ template<typename ImplStruct>
 struct simd_dispatcher {
     template<typename... Args>
     static auto dispatch(Args&&... args) {
-#if LIBTRADIER_SIMD_ACTIVE
+#if LIBTRADIER_SIMD_RUNTIME_DISPATCH
+        switch (active_isa()) {
+            case isa::avx512:
+                return ImplStruct::avx512(std::forward<Args>(args)...);
+            case isa::avx2:
+                return ImplStruct::avx2(std::forward<Args>(args)...);
+            default:
+                return ImplStruct::scalar(std::forward<Args>(args)...);
+        }
+#elif LIBTRADIER_SIMD_ACTIVE
         #if LIBTRADIER_SIMD_AVX512_AVAILABLE
             return ImplStruct::avx512(std::forward<Args>(args)...);
         #elif LIBTRADIER_SIMD_AVX2_AVAILABLE
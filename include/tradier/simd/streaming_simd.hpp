@@ -27,11 +27,11 @@ struct bulk_string_to_double_impl {
     static size_t scalar(const nlohmann::json* json_strings, double* output, size_t count);
     
 #if LIBTRADIER_SIMD_AVX2_AVAILABLE
-    static size_t avx2(const nlohmann::json* json_strings, double* output, size_t count);
+    LIBTRADIER_SIMD_TARGET_AVX2 static size_t avx2(const nlohmann::json* json_strings, double* output, size_t count);
 #endif
 
 #if LIBTRADIER_SIMD_AVX512_AVAILABLE
-    static size_t avx512(const nlohmann::json* json_strings, double* output, size_t count);
+    LIBTRADIER_SIMD_TARGET_AVX512 static size_t avx512(const nlohmann::json* json_strings, double* output, size_t count);
 #endif
 };
 
@@ -54,13 +54,13 @@ struct bulk_process_events_impl {
                         std::function<void(const tradier::QuoteEvent&)> quoteHandler);
     
 #if LIBTRADIER_SIMD_AVX2_AVAILABLE
-    static size_t avx2(const nlohmann::json* events, size_t count,
+    LIBTRADIER_SIMD_TARGET_AVX2 static size_t avx2(const nlohmann::json* events, size_t count,
                       std::function<void(const tradier::TradeEvent&)> tradeHandler,
                       std::function<void(const tradier::QuoteEvent&)> quoteHandler);
 #endif
 
 #if LIBTRADIER_SIMD_AVX512_AVAILABLE
-    static size_t avx512(const nlohmann::json* events, size_t count,
+    LIBTRADIER_SIMD_TARGET_AVX512 static size_t avx512(const nlohmann::json* events, size_t count,
                         std::function<void(const tradier::TradeEvent&)> tradeHandler,
                         std::function<void(const tradier::QuoteEvent&)> quoteHandler);
 #endif
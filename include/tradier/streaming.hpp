@@ -11,8 +11,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <atomic>
@@ -20,11 +24,13 @@
 #include <mutex>
 #include <shared_mutex>
 #include <queue>
+#include "tradier/common/latency_histogram.hpp"
 #include "tradier/common/types.hpp"
 
 namespace tradier {
 
 class TradierClient;
+class MarketStateCache;
 
 enum class StreamEventType {
     TRADE,
@@ -106,6 +112,76 @@ struct AccountPositionEvent {
     TimePoint timestamp;
 };
 
+using SymbolId = uint32_t;
+
+// Maps symbols to dense ids for the compact events. Ids are assigned in
+// first-seen order, never reused, and names stay valid for the table's lifetime.
+class SymbolTable {
+private:
+    mutable std::shared_mutex mutex_;
+    std::deque<std::string> names_;
+    std::unordered_map<std::string_view, SymbolId> ids_;
+
+public:
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+    
+    SymbolId intern(std::string_view symbol);
+    std::optional<SymbolId> find(std::string_view symbol) const;
+    std::string_view name(SymbolId id) const;
+    size_t size() const;
+};
+
+enum class TradingSession : uint8_t {
+    UNKNOWN,
+    PRE,
+    NORMAL,
+    POST
+};
+
+// Compact counterparts of TradeEvent/QuoteEvent/TimesaleEvent: no heap
+// members, exchange codes as single chars, dates as epoch milliseconds
+struct CompactTradeEvent {
+    int64_t timestampMs = 0;
+    double price = 0.0;
+    double last = 0.0;
+    int64_t cvol = 0;
+    SymbolId symbol = 0;
+    int32_t size = 0;
+    StreamEventType type = StreamEventType::TRADE;
+    char exchange = '\0';
+};
+
+struct CompactQuoteEvent {
+    int64_t bidTimeMs = 0;
+    int64_t askTimeMs = 0;
+    double bid = 0.0;
+    double ask = 0.0;
+    SymbolId symbol = 0;
+    int32_t bidSize = 0;
+    int32_t askSize = 0;
+    StreamEventType type = StreamEventType::QUOTE;
+    char bidExchange = '\0';
+    char askExchange = '\0';
+};
+
+struct CompactTimesaleEvent {
+    int64_t timestampMs = 0;
+    double bid = 0.0;
+    double ask = 0.0;
+    double last = 0.0;
+    SymbolId symbol = 0;
+    int32_t size = 0;
+    int32_t seq = 0;
+    StreamEventType type = StreamEventType::TIMESALE;
+    char exchange = '\0';
+    char flag = '\0';
+    TradingSession session = TradingSession::UNKNOWN;
+    bool cancel = false;
+    bool correction = false;
+};
+
 using TradeEventHandler = std::function<void(const TradeEvent&)>;
 using QuoteEventHandler = std::function<void(const QuoteEvent&)>;
 using SummaryEventHandler = std::function<void(const SummaryEvent&)>;
@@ -114,6 +190,21 @@ using AccountOrderEventHandler = std::function<void(const AccountOrderEvent&)>;
 using AccountPositionEventHandler = std::function<void(const AccountPositionEvent&)>;
 using ErrorHandler = std::function<void(const std::string&)>;
 
+using CompactTradeEventHandler = std::function<void(const CompactTradeEvent&)>;
+using CompactQuoteEventHandler = std::function<void(const CompactQuoteEvent&)>;
+using CompactTimesaleEventHandler = std::function<void(const CompactTimesaleEvent&)>;
+
+enum class DispatchMode {
+    INLINE,   // handlers run on the socket read thread
+    QUEUED    // the read thread decodes into a ring; consumer threads run handlers
+};
+
+enum class OverflowPolicy {
+    BLOCK,        // reader waits for space (TCP backpressure reaches the feed)
+    DROP_OLDEST,  // oldest queued event is discarded
+    CONFLATE      // overflow keeps only the newest event per symbol and type
+};
+
 struct StreamingConfig {
     bool autoReconnect = true;
     int reconnectDelay = 5000; // milliseconds
@@ -121,6 +212,22 @@ struct StreamingConfig {
     int heartbeatInterval = 30000; // milliseconds
     bool filterDuplicates = true;
     std::vector<std::string> validExchanges;
+    
+    // Applied on connect() or the first processMessage(). With more than one
+    // consumer thread, handlers may run concurrently and per-symbol ordering
+    // is not preserved.
+    DispatchMode dispatchMode = DispatchMode::INLINE;
+    size_t queueCapacity = 8192; // rounded up to a power of two
+    OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK;
+    int consumerThreads = 1;
+    
+    // Quotes bypass the ring into a latest-value slot per symbol; a lagging
+    // consumer sees only the newest quote. Implies QUEUED dispatch.
+    bool conflateQuotes = false;
+    
+    // Fills StreamStatistics::feedLatency and dispatchLatency. Off by default:
+    // it adds a clock read and two histogram updates to every frame.
+    bool recordLatency = false;
 };
 
 struct StreamSession {
@@ -136,22 +243,39 @@ struct StreamStatistics {
     std::atomic<long> errors{0};
     std::atomic<long> reconnects{0};
     
+    // QUEUED dispatch
+    std::atomic<long> eventsQueued{0};
+    std::atomic<long> eventsDropped{0};
+    std::atomic<long> eventsConflated{0};
+    std::atomic<long> producerStalls{0};
+    std::atomic<long> queueHighWater{0};
+    std::atomic<long> quotesConflated{0};
+    
+    // Only recorded with StreamingConfig::recordLatency. Nanoseconds from the
+    // event's exchange timestamp to the frame arriving (frames without a
+    // timestamp, or stamped in the future, are skipped), and from the frame
+    // arriving to its handler being invoked
+    LatencyHistogram feedLatency;
+    LatencyHistogram dispatchLatency;
+    
 private:
-    mutable std::shared_mutex timeMutex_;
-    TimePoint connectionStart;
-    TimePoint lastMessage;
+    // Nanoseconds since the epoch, 0 when unset
+    std::atomic<int64_t> connectionStartNs_{0};
+    std::atomic<int64_t> lastMessageNs_{0};
+    
+    static int64_t toNanos(const TimePoint& time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+    
+    static TimePoint fromNanos(int64_t nanos) {
+        return TimePoint(std::chrono::duration_cast<TimePoint::duration>(std::chrono::nanoseconds(nanos)));
+    }
 
 public:
     StreamStatistics() = default;
     
-    StreamStatistics(const StreamStatistics& other) 
-        : messagesReceived(other.messagesReceived.load()),
-          messagesProcessed(other.messagesProcessed.load()),
-          errors(other.errors.load()),
-          reconnects(other.reconnects.load()) {
-        std::shared_lock lock(other.timeMutex_);
-        connectionStart = other.connectionStart;
-        lastMessage = other.lastMessage;
+    StreamStatistics(const StreamStatistics& other) {
+        *this = other;
     }
     
     StreamStatistics& operator=(const StreamStatistics& other) {
@@ -160,33 +284,43 @@ public:
             messagesProcessed.store(other.messagesProcessed.load());
             errors.store(other.errors.load());
             reconnects.store(other.reconnects.load());
-            
-            std::shared_lock otherLock(other.timeMutex_);
-            std::unique_lock thisLock(timeMutex_);
-            connectionStart = other.connectionStart;
-            lastMessage = other.lastMessage;
+            eventsQueued.store(other.eventsQueued.load());
+            eventsDropped.store(other.eventsDropped.load());
+            eventsConflated.store(other.eventsConflated.load());
+            producerStalls.store(other.producerStalls.load());
+            queueHighWater.store(other.queueHighWater.load());
+            quotesConflated.store(other.quotesConflated.load());
+            feedLatency = other.feedLatency;
+            dispatchLatency = other.dispatchLatency;
+            connectionStartNs_.store(other.connectionStartNs_.load());
+            lastMessageNs_.store(other.lastMessageNs_.load());
         }
         return *this;
     }
     
+    static int64_t nowNanos() {
+        return toNanos(std::chrono::system_clock::now());
+    }
+    
     void setConnectionStart(const TimePoint& time) {
-        std::unique_lock lock(timeMutex_);
-        connectionStart = time;
+        connectionStartNs_.store(toNanos(time), std::memory_order_relaxed);
     }
     
     void setLastMessage(const TimePoint& time) {
-        std::unique_lock lock(timeMutex_);
-        lastMessage = time;
+        setLastMessageNanos(toNanos(time));
+    }
+    
+    // Per-message path: a single relaxed store
+    void setLastMessageNanos(int64_t nanos) {
+        lastMessageNs_.store(nanos, std::memory_order_relaxed);
     }
     
     TimePoint getConnectionStart() const {
-        std::shared_lock lock(timeMutex_);
-        return connectionStart;
+        return fromNanos(connectionStartNs_.load(std::memory_order_relaxed));
     }
     
     TimePoint getLastMessage() const {
-        std::shared_lock lock(timeMutex_);
-        return lastMessage;
+        return fromNanos(lastMessageNs_.load(std::memory_order_relaxed));
     }
     
     struct Snapshot {
@@ -194,19 +328,34 @@ public:
         long messagesProcessed;
         long errors;
         long reconnects;
+        long eventsQueued;
+        long eventsDropped;
+        long eventsConflated;
+        long producerStalls;
+        long queueHighWater;
+        long quotesConflated;
         TimePoint connectionStart;
         TimePoint lastMessage;
+        LatencyHistogram::Snapshot feedLatency;
+        LatencyHistogram::Snapshot dispatchLatency;
     };
     
     Snapshot getSnapshot() const {
-        std::shared_lock lock(timeMutex_);
         return {
             messagesReceived.load(),
             messagesProcessed.load(),
             errors.load(),
             reconnects.load(),
-            connectionStart,
-            lastMessage
+            eventsQueued.load(),
+            eventsDropped.load(),
+            eventsConflated.load(),
+            producerStalls.load(),
+            queueHighWater.load(),
+            quotesConflated.load(),
+            getConnectionStart(),
+            getLastMessage(),
+            feedLatency.snapshot(),
+            dispatchLatency.snapshot()
         };
     }
     
@@ -215,10 +364,16 @@ public:
         messagesProcessed.store(0);
         errors.store(0);
         reconnects.store(0);
-        
-        std::unique_lock lock(timeMutex_);
-        connectionStart = TimePoint{};
-        lastMessage = TimePoint{};
+        eventsQueued.store(0);
+        eventsDropped.store(0);
+        eventsConflated.store(0);
+        producerStalls.store(0);
+        queueHighWater.store(0);
+        quotesConflated.store(0);
+        feedLatency.reset();
+        dispatchLatency.reset();
+        connectionStartNs_.store(0);
+        lastMessageNs_.store(0);
     }
 };
 
@@ -229,6 +384,12 @@ private:
     class Impl;
     std::unique_ptr<Impl> impl_;
     
+    bool subscribeMarketEvents(const StreamSession& session, const std::vector<std::string>& symbols, const char* eventType);
+    
+    friend class ShardedStreamingService;
+    void shareSymbolTable(std::shared_ptr<SymbolTable> table);
+    void shareMarketState(std::shared_ptr<MarketStateCache> cache);
+    
 public:
     explicit StreamingService(TradierClient& client);
     ~StreamingService();
@@ -266,6 +427,34 @@ public:
         TimesaleEventHandler handler
     );
     
+    // Compact delivery; may be combined with the regular handlers above.
+    // Resolve SymbolIds through symbols().
+    bool subscribeToTradesCompact(
+        const StreamSession& session,
+        const std::vector<std::string>& symbols,
+        CompactTradeEventHandler handler
+    );
+    
+    bool subscribeToQuotesCompact(
+        const StreamSession& session,
+        const std::vector<std::string>& symbols,
+        CompactQuoteEventHandler handler
+    );
+    
+    bool subscribeToTimesalesCompact(
+        const StreamSession& session,
+        const std::vector<std::string>& symbols,
+        CompactTimesaleEventHandler handler
+    );
+    
+    const SymbolTable& symbols() const;
+    
+    // Keeps a MarketStateCache current from the quote and trade frames that
+    // pass the filters, updated on the read thread before handlers run.
+    // Call before connect(); repeated calls return the same cache.
+    std::shared_ptr<MarketStateCache> enableMarketState();
+    std::shared_ptr<MarketStateCache> marketState() const;
+    
     bool subscribeToOrderEvents(
         const StreamSession& session,
         AccountOrderEventHandler handler
@@ -289,6 +478,12 @@ public:
     bool isConnected() const;
     void reconnect();
     
+    // Runs a raw frame through decoding, filters and dispatch as if it had
+    // arrived on the socket (replaying captured feeds, benchmarks). Must not
+    // race with a live connection's read thread. Starts QUEUED dispatch as
+    // connect() would; disconnect() drains and stops it.
+    void processMessage(std::string_view message);
+    
     StreamStatistics::Snapshot getStatistics() const;
     void resetStatistics();
     std::string getConnectionStatus() const;
@@ -298,4 +493,68 @@ public:
     void clearFilters();
 };
 
+// Splits a symbol universe across several market sessions, each with its
+// own WebSocket and read thread. Symbols map to shards by a stable hash and
+// all shards share one SymbolTable, so compact events look the same whichever
+// shard decoded them. Handlers may run concurrently from different shards.
+class ShardedStreamingService {
+private:
+    std::vector<std::unique_ptr<StreamingService>> shards_;
+    std::vector<StreamSession> sessions_;
+    std::shared_ptr<SymbolTable> symbols_;
+    std::shared_ptr<MarketStateCache> marketState_;
+    
+    std::vector<std::vector<std::string>> partition(const std::vector<std::string>& symbols) const;
+    
+    template<typename Handler>
+    bool subscribeAll(
+        const std::vector<std::string>& symbols,
+        Handler handler,
+        bool (StreamingService::*subscribe)(const StreamSession&, const std::vector<std::string>&, Handler)
+    );
+
+public:
+    ShardedStreamingService(TradierClient& client, size_t shardCount);
+    ~ShardedStreamingService();
+    
+    ShardedStreamingService(const ShardedStreamingService&) = delete;
+    ShardedStreamingService& operator=(const ShardedStreamingService&) = delete;
+    
+    // One market session per shard; required before subscribing
+    Result<std::vector<StreamSession>> createMarketSessions();
+    
+    size_t shardCount() const;
+    size_t shardFor(std::string_view symbol) const;
+    StreamingService& shard(size_t index);
+    
+    bool subscribeToTrades(const std::vector<std::string>& symbols, TradeEventHandler handler);
+    bool subscribeToQuotes(const std::vector<std::string>& symbols, QuoteEventHandler handler);
+    bool subscribeToSummary(const std::vector<std::string>& symbols, SummaryEventHandler handler);
+    bool subscribeToTimesales(const std::vector<std::string>& symbols, TimesaleEventHandler handler);
+    bool subscribeToTradesCompact(const std::vector<std::string>& symbols, CompactTradeEventHandler handler);
+    bool subscribeToQuotesCompact(const std::vector<std::string>& symbols, CompactQuoteEventHandler handler);
+    bool subscribeToTimesalesCompact(const std::vector<std::string>& symbols, CompactTimesaleEventHandler handler);
+    
+    const SymbolTable& symbols() const;
+    
+    // One cache shared by every shard
+    std::shared_ptr<MarketStateCache> enableMarketState();
+    std::shared_ptr<MarketStateCache> marketState() const;
+    
+    void setConfig(const StreamingConfig& config);
+    void setErrorHandler(ErrorHandler handler);
+    
+    void connect();
+    void disconnect();
+    bool isConnected() const;
+    
+    // Counters summed across shards; queueHighWater is the largest shard's
+    StreamStatistics::Snapshot getStatistics() const;
+    void resetStatistics();
+    
+    void setSymbolFilter(const std::vector<std::string>& symbols);
+    void setExchangeFilter(const std::vector<std::string>& exchanges);
+    void clearFilters();
+};
+
 }
\ No newline at end of file
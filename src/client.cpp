@@ -18,10 +18,14 @@
 #include "tradier/watchlist.hpp"
 #include "tradier/common/http_client.hpp"
 #include "tradier/common/errors.hpp"
+#include "tradier/common/single_flight.hpp"
+#include "tradier/common/response_cache.hpp"
 
 namespace tradier {
 TradierClient::TradierClient(const Config& config) 
-    : config_(config), httpClient_(std::make_unique<HttpClient>(config)) {
+    : config_(config), httpClient_(std::make_unique<HttpClient>(config)),
+      requestCoalescer_(config.coalesceRequests ? std::make_shared<SingleFlight>() : nullptr),
+      responseCache_(config.cacheReferenceData ? std::make_shared<ResponseCache>(config.referenceCacheBytes) : nullptr) {
     if (config_.accessToken.empty()) {
         throw AuthenticationError("Access token required");
     }
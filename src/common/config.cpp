@@ -54,6 +54,29 @@ Config Config::fromEnvironment() {
         } catch (...) {  /* Keep default if invalid */  }
     }
     
+    const char* maxConnectionsEnv = std::getenv("TRADIER_API_MAX_CONNECTIONS");
+    if (maxConnectionsEnv) {
+        try {
+            config.maxConnections = std::stoi(maxConnectionsEnv);
+        } catch (...) {  /* Keep default if invalid */  }
+    }
+    
+    const char* http2Env = std::getenv("TRADIER_API_HTTP2");
+    if (http2Env) {
+        std::string http2Str(http2Env);
+        config.http2 = (http2Str == "1" || 
+                        http2Str == "true" || 
+                        http2Str == "yes" || 
+                        http2Str == "on");
+    }
+    
+    const char* maxStreamsEnv = std::getenv("TRADIER_API_MAX_STREAMS");
+    if (maxStreamsEnv) {
+        try {
+            config.maxConcurrentStreams = std::stoi(maxStreamsEnv);
+        } catch (...) {  /* Keep default if invalid */  }
+    }
+    
     return config;
 }
 
@@ -16,6 +16,16 @@
 #include <sstream>
 #include <memory>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <future>
+#include <optional>
 #include <cmath>
 #include <thread>
 
@@ -53,6 +63,13 @@ namespace {
         }
         return size * nitems;
     }
+    
+    void ensureCurlGlobalInit() {
+        static std::once_flag once;
+        std::call_once(once, [] {
+            curl_global_init(CURL_GLOBAL_DEFAULT);
+        });
+    }
 }
 
 class CurlHandle {
@@ -60,7 +77,9 @@ private:
     void* handle_;
 
 public:
-    CurlHandle() : handle_(curl_easy_init()) {
+    CurlHandle() : handle_(nullptr) {
+        ensureCurlGlobalInit();
+        handle_ = curl_easy_init();
         if (!handle_) {
             throw ConnectionError("Failed to initialize CURL");
         }
@@ -140,27 +159,731 @@ public:
     struct curl_slist* get() const noexcept { return list_; }
 };
 
+// Share handle for the DNS and TLS session caches so every pooled easy handle
+// benefits from lookups and handshakes done by the others. The connection cache
+// itself stays per handle: libcurl does not support sharing it across threads.
+class CurlShare {
+private:
+    CURLSH* share_;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> locks_;
+    
+    static void lockCallback(CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+        static_cast<CurlShare*>(userptr)->locks_[data].lock();
+    }
+    
+    static void unlockCallback(CURL*, curl_lock_data data, void* userptr) {
+        static_cast<CurlShare*>(userptr)->locks_[data].unlock();
+    }
+
+public:
+    CurlShare() : share_(nullptr) {
+        ensureCurlGlobalInit();
+        share_ = curl_share_init();
+        if (!share_) {
+            throw ConnectionError("Failed to initialize CURL share handle");
+        }
+        curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, lockCallback);
+        curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, unlockCallback);
+        curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+    
+    ~CurlShare() {
+        if (share_) {
+            curl_share_cleanup(share_);
+        }
+    }
+    
+    CurlShare(const CurlShare&) = delete;
+    CurlShare& operator=(const CurlShare&) = delete;
+    
+    CURLSH* get() const noexcept { return share_; }
+};
+
+// Bounded pool of easy handles. curl_easy_reset keeps a handle's live
+// connections, so a handle returned to the pool carries its warm keep-alive
+// TLS connection into the next request that leases it.
+class CurlHandlePool {
+private:
+    const size_t maxHandles_;
+    std::vector<std::unique_ptr<CurlHandle>> idle_;
+    size_t created_ = 0;
+    std::mutex mutex_;
+    std::condition_variable available_;
+    std::atomic<uint64_t> waits_{0};
+
+public:
+    class Lease {
+    private:
+        CurlHandlePool* pool_;
+        std::unique_ptr<CurlHandle> handle_;
+        
+    public:
+        Lease(CurlHandlePool* pool, std::unique_ptr<CurlHandle> handle)
+            : pool_(pool), handle_(std::move(handle)) {}
+        
+        ~Lease() {
+            if (pool_ && handle_) {
+                pool_->release(std::move(handle_));
+            }
+        }
+        
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        
+        CurlHandle& operator*() const noexcept { return *handle_; }
+        CurlHandle* operator->() const noexcept { return handle_.get(); }
+    };
+    
+    explicit CurlHandlePool(size_t maxHandles) : maxHandles_(maxHandles > 0 ? maxHandles : 1) {
+        idle_.reserve(maxHandles_);
+    }
+    
+    CurlHandlePool(const CurlHandlePool&) = delete;
+    CurlHandlePool& operator=(const CurlHandlePool&) = delete;
+    
+    Lease acquire() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        
+        if (idle_.empty() && created_ >= maxHandles_) {
+            waits_.fetch_add(1, std::memory_order_relaxed);
+            available_.wait(lock, [this] { return !idle_.empty(); });
+        }
+        
+        if (!idle_.empty()) {
+            auto handle = std::move(idle_.back());
+            idle_.pop_back();
+            return Lease(this, std::move(handle));
+        }
+        
+        ++created_;
+        lock.unlock();
+        
+        try {
+            return Lease(this, std::make_unique<CurlHandle>());
+        } catch (...) {
+            std::lock_guard<std::mutex> relock(mutex_);
+            --created_;
+            available_.notify_one();
+            throw;
+        }
+    }
+    
+    uint64_t waits() const noexcept { return waits_.load(std::memory_order_relaxed); }
+    void resetWaits() noexcept { waits_.store(0, std::memory_order_relaxed); }
+
+private:
+    void release(std::unique_ptr<CurlHandle> handle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            idle_.push_back(std::move(handle));
+        }
+        available_.notify_one();
+    }
+};
+
+// Everything one HTTP exchange needs while libcurl works on it. libcurl keeps
+// pointers into the URL, body and header list, so a Transfer must stay alive
+// (and in place) until its handle is finished.
+struct Transfer {
+    std::string method;
+    std::string url;
+    std::string postData;
+    std::shared_ptr<const CurlSlist> headers;
+    long timeoutSeconds = 30;
+    CURLSH* share = nullptr;
+    bool http2 = false;
+    bool compress = false;
+    
+    std::string responseBody;
+    Headers responseHeaders;
+    
+    // Set for streaming requests: a 2xx body goes to bodyHandler as it
+    // arrives instead of into responseBody
+    HttpClient::BodyHandler bodyHandler;
+    std::exception_ptr bodyError;
+    CURL* handle = nullptr;
+    int streaming = -1;
+    uint64_t streamedBytes = 0;
+    
+    static size_t streamCallback(char* contents, size_t size, size_t nmemb, void* userdata) {
+        auto* transfer = static_cast<Transfer*>(userdata);
+        size_t length = size * nmemb;
+        try {
+            if (transfer->streaming < 0) {
+                long status = 0;
+                curl_easy_getinfo(transfer->handle, CURLINFO_RESPONSE_CODE, &status);
+                transfer->streaming = status >= 200 && status < 300;
+            }
+            if (transfer->streaming) {
+                transfer->streamedBytes += length;
+                transfer->bodyHandler(std::string_view(contents, length));
+            } else {
+                transfer->responseBody.append(contents, length);
+            }
+            return length;
+        } catch (...) {
+            transfer->bodyError = std::current_exception();
+            return 0;
+        }
+    }
+    
+    void apply(CURL* handle) {
+        this->handle = handle;
+        curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+        if (bodyHandler) {
+            curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, streamCallback);
+            curl_easy_setopt(handle, CURLOPT_WRITEDATA, this);
+        } else {
+            curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, writeCallback);
+            curl_easy_setopt(handle, CURLOPT_WRITEDATA, &responseBody);
+        }
+        curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, headerCallback);
+        curl_easy_setopt(handle, CURLOPT_HEADERDATA, &responseHeaders);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT, timeoutSeconds);
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(handle, CURLOPT_SHARE, share);
+        if (compress) {
+            curl_easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, "");
+        }
+        
+        if (http2) {
+            // Falls back to HTTP/1.1 when ALPN does not offer h2; PIPEWAIT
+            // prefers a stream on a pending connection over opening another
+            curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+            curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+        }
+        
+        if (method == "POST") {
+            curl_easy_setopt(handle, CURLOPT_POST, 1L);
+            curl_easy_setopt(handle, CURLOPT_POSTFIELDS, postData.c_str());
+        } else if (method == "PUT") {
+            curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "PUT");
+            curl_easy_setopt(handle, CURLOPT_POSTFIELDS, postData.c_str());
+        } else if (method == "DELETE") {
+            curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "DELETE");
+        } else {
+            curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
+        }
+        
+        curl_easy_setopt(handle, CURLOPT_HTTPHEADER, headers ? headers->get() : nullptr);
+    }
+    
+    Response toResponse(CURL* handle) {
+        long statusCode = 0;
+        curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &statusCode);
+        return {static_cast<int>(statusCode), std::move(responseBody), std::move(responseHeaders)};
+    }
+};
+
+// One I/O thread driving a curl multi handle. Transfers are queued from any
+// thread and completed on the I/O thread, so hundreds of requests can be in
+// flight without a thread per request. Delayed submissions (retry backoff)
+// wait in a timer heap instead of sleeping a caller's thread.
+class CurlMultiEngine {
+public:
+    using Completion = std::function<void(Transfer&, CURL*, CURLcode)>;
+
+private:
+    struct Job {
+        std::unique_ptr<Transfer> transfer;
+        Completion completion;
+        std::chrono::steady_clock::time_point due;
+        std::unique_ptr<CurlHandle> handle;
+    };
+    
+    static bool laterDue(const std::unique_ptr<Job>& a, const std::unique_ptr<Job>& b) {
+        return a->due > b->due;
+    }
+    
+    static constexpr size_t MAX_SPARE_HANDLES = 64;
+    
+    CURLM* multi_;
+    size_t activeLimit_;
+    std::mutex mutex_;
+    bool closed_ = false;
+    std::vector<std::unique_ptr<Job>> incoming_;
+    std::vector<std::unique_ptr<Job>> delayed_;
+    std::unordered_map<CURL*, std::unique_ptr<Job>> active_;
+    std::vector<std::unique_ptr<CurlHandle>> spareHandles_;
+    std::atomic<bool> stopping_{false};
+    std::thread thread_;
+
+public:
+    // maxConcurrentStreams > 0 enables HTTP/2 multiplexing with that many
+    // streams per connection
+    CurlMultiEngine(long maxConnections, long maxConcurrentStreams)
+        : multi_(nullptr),
+          activeLimit_(static_cast<size_t>(std::max(1L, maxConnections) * std::max(1L, maxConcurrentStreams))) {
+        ensureCurlGlobalInit();
+        multi_ = curl_multi_init();
+        if (!multi_) {
+            throw ConnectionError("Failed to initialize CURL multi handle");
+        }
+        curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, maxConnections);
+        curl_multi_setopt(multi_, CURLMOPT_MAX_TOTAL_CONNECTIONS, maxConnections);
+        
+        if (maxConcurrentStreams > 0) {
+            curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+            curl_multi_setopt(multi_, CURLMOPT_MAX_CONCURRENT_STREAMS, maxConcurrentStreams);
+        }
+        
+        thread_ = std::thread([this] { run(); });
+    }
+    
+    ~CurlMultiEngine() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_.store(true, std::memory_order_release);
+        }
+        curl_multi_wakeup(multi_);
+        
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        
+        curl_multi_cleanup(multi_);
+    }
+    
+    CurlMultiEngine(const CurlMultiEngine&) = delete;
+    CurlMultiEngine& operator=(const CurlMultiEngine&) = delete;
+    
+    bool submit(std::unique_ptr<Transfer> transfer, std::chrono::milliseconds delay, Completion completion) {
+        auto job = std::make_unique<Job>();
+        job->transfer = std::move(transfer);
+        job->completion = std::move(completion);
+        job->due = std::chrono::steady_clock::now() + delay;
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_ || stopping_.load(std::memory_order_acquire)) {
+                return false;
+            }
+            incoming_.push_back(std::move(job));
+        }
+        
+        curl_multi_wakeup(multi_);
+        return true;
+    }
+
+private:
+    void run() {
+        while (!stopping_.load(std::memory_order_acquire)) {
+            admit();
+            
+            int running = 0;
+            curl_multi_perform(multi_, &running);
+            completeFinished();
+            
+            curl_multi_poll(multi_, nullptr, 0, pollTimeoutMs(), nullptr);
+        }
+        
+        abortAll();
+    }
+    
+    void admit() {
+        std::vector<std::unique_ptr<Job>> incoming;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            incoming.swap(incoming_);
+        }
+        
+        for (auto& job : incoming) {
+            delayed_.push_back(std::move(job));
+            std::push_heap(delayed_.begin(), delayed_.end(), laterDue);
+        }
+        
+        // Transfers are held here rather than left pending inside curl for a
+        // free connection: curl does not always wake those promptly, which
+        // stalled bursts until the next poll timeout
+        auto now = std::chrono::steady_clock::now();
+        while (!delayed_.empty() && delayed_.front()->due <= now && active_.size() < activeLimit_) {
+            std::pop_heap(delayed_.begin(), delayed_.end(), laterDue);
+            auto job = std::move(delayed_.back());
+            delayed_.pop_back();
+            start(std::move(job));
+        }
+    }
+    
+    void start(std::unique_ptr<Job> job) {
+        try {
+            if (!spareHandles_.empty()) {
+                job->handle = std::move(spareHandles_.back());
+                spareHandles_.pop_back();
+                job->handle->reset();
+            } else {
+                job->handle = std::make_unique<CurlHandle>();
+            }
+            
+            CURL* easy = job->handle->get();
+            job->transfer->apply(easy);
+            
+            CURLMcode rc = curl_multi_add_handle(multi_, easy);
+            if (rc != CURLM_OK) {
+                throw ConnectionError(std::string("CURL multi error: ") + curl_multi_strerror(rc));
+            }
+            active_.emplace(easy, std::move(job));
+        } catch (const std::exception&) {
+            complete(*job, CURLE_FAILED_INIT);
+        }
+    }
+    
+    void completeFinished() {
+        int remaining = 0;
+        while (CURLMsg* message = curl_multi_info_read(multi_, &remaining)) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            
+            CURL* easy = message->easy_handle;
+            CURLcode result = message->data.result;
+            curl_multi_remove_handle(multi_, easy);
+            
+            auto it = active_.find(easy);
+            if (it == active_.end()) {
+                continue;
+            }
+            
+            auto job = std::move(it->second);
+            active_.erase(it);
+            complete(*job, result);
+            recycle(std::move(job->handle));
+        }
+    }
+    
+    void complete(Job& job, CURLcode result) {
+        try {
+            job.completion(*job.transfer, job.handle ? job.handle->get() : nullptr, result);
+        } catch (...) {
+            // Completions must not take down the I/O thread
+        }
+    }
+    
+    void recycle(std::unique_ptr<CurlHandle> handle) {
+        if (handle && spareHandles_.size() < MAX_SPARE_HANDLES) {
+            spareHandles_.push_back(std::move(handle));
+        }
+    }
+    
+    int pollTimeoutMs() const {
+        constexpr int maxWaitMs = 1000;
+        if (delayed_.empty() || active_.size() >= activeLimit_) {
+            return maxWaitMs;
+        }
+        
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+            delayed_.front()->due - std::chrono::steady_clock::now()).count();
+        return static_cast<int>(std::clamp<long long>(wait, 0, maxWaitMs));
+    }
+    
+    void abortAll() {
+        std::vector<std::unique_ptr<Job>> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            pending.swap(incoming_);
+        }
+        
+        for (auto& [easy, job] : active_) {
+            curl_multi_remove_handle(multi_, easy);
+            complete(*job, CURLE_ABORTED_BY_CALLBACK);
+        }
+        active_.clear();
+        
+        for (auto& job : delayed_) {
+            complete(*job, CURLE_ABORTED_BY_CALLBACK);
+        }
+        delayed_.clear();
+        
+        for (auto& job : pending) {
+            complete(*job, CURLE_ABORTED_BY_CALLBACK);
+        }
+    }
+};
+
+namespace {
+
+// "GET /accounts/{id}/orders/{id}": query dropped and every path segment
+// containing a digit (account numbers, order ids) collapsed to {id}, so the
+// key set stays bounded by the API's routes
+std::string endpointKey(const std::string& method, const std::string& endpoint) {
+    std::string key = method;
+    key += ' ';
+    
+    std::string_view path(endpoint);
+    path = path.substr(0, path.find('?'));
+    size_t pos = 0;
+    while (pos <= path.size()) {
+        size_t end = std::min(path.find('/', pos), path.size());
+        auto segment = path.substr(pos, end - pos);
+        if (!segment.empty()) {
+            key += '/';
+            bool id = std::any_of(segment.begin(), segment.end(), [](char c) { return c >= '0' && c <= '9'; });
+            key += id ? std::string_view("{id}") : segment;
+        }
+        pos = end + 1;
+    }
+    if (key.size() == method.size() + 1) {
+        key += '/';
+    }
+    return key;
+}
+
+std::optional<int64_t> headerNumber(const Headers& headers, std::string_view name) {
+    for (const auto& [key, value] : headers) {
+        bool matches = key.size() == name.size() &&
+            std::equal(key.begin(), key.end(), name.begin(), [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+            });
+        if (matches) {
+            int64_t number = 0;
+            auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), number);
+            if (error == std::errc()) {
+                return number;
+            }
+            return std::nullopt;
+        }
+    }
+    return std::nullopt;
+}
+
+}
+
+struct EndpointStats {
+    const std::string endpoint;
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> failures{0};
+    std::atomic<uint64_t> attempts{0};
+    std::atomic<uint64_t> bytesSent{0};
+    std::atomic<uint64_t> bytesReceived{0};
+    std::atomic<uint64_t> compressedBytes{0};
+    std::atomic<uint64_t> uncompressedBytes{0};
+    LatencyHistogram latency;
+    LatencyHistogram nameLookup;
+    LatencyHistogram connect;
+    LatencyHistogram tlsHandshake;
+    LatencyHistogram timeToFirstByte;
+    
+    explicit EndpointStats(std::string key) : endpoint(std::move(key)) {}
+    
+    // Phase timings of one finished attempt; `decodedBytes` is the body as
+    // delivered, after any Content-Encoding was undone
+    void recordAttempt(CURL* handle, bool newConnection, uint64_t decodedBytes) {
+        curl_off_t nameLookupUs = 0, connectUs = 0, tlsUs = 0, pretransferUs = 0, firstByteUs = 0;
+        curl_off_t downloaded = 0;
+        long requestSize = 0, headerSize = 0;
+        curl_easy_getinfo(handle, CURLINFO_NAMELOOKUP_TIME_T, &nameLookupUs);
+        curl_easy_getinfo(handle, CURLINFO_CONNECT_TIME_T, &connectUs);
+        curl_easy_getinfo(handle, CURLINFO_APPCONNECT_TIME_T, &tlsUs);
+        curl_easy_getinfo(handle, CURLINFO_PRETRANSFER_TIME_T, &pretransferUs);
+        curl_easy_getinfo(handle, CURLINFO_STARTTRANSFER_TIME_T, &firstByteUs);
+        curl_easy_getinfo(handle, CURLINFO_SIZE_DOWNLOAD_T, &downloaded);
+        curl_easy_getinfo(handle, CURLINFO_REQUEST_SIZE, &requestSize);
+        curl_easy_getinfo(handle, CURLINFO_HEADER_SIZE, &headerSize);
+        
+        auto nanos = [](curl_off_t micros) { return static_cast<uint64_t>(std::max<curl_off_t>(micros, 0)) * 1000; };
+        
+        attempts.fetch_add(1, std::memory_order_relaxed);
+        bytesSent.fetch_add(static_cast<uint64_t>(std::max(requestSize, 0L)), std::memory_order_relaxed);
+        bytesReceived.fetch_add(static_cast<uint64_t>(std::max(headerSize, 0L)) +
+                                static_cast<uint64_t>(std::max<curl_off_t>(downloaded, 0)), std::memory_order_relaxed);
+        compressedBytes.fetch_add(static_cast<uint64_t>(std::max<curl_off_t>(downloaded, 0)), std::memory_order_relaxed);
+        uncompressedBytes.fetch_add(decodedBytes, std::memory_order_relaxed);
+        
+        if (newConnection) {
+            nameLookup.record(nanos(nameLookupUs));
+            connect.record(nanos(connectUs - nameLookupUs));
+            if (tlsUs > 0) {
+                tlsHandshake.record(nanos(tlsUs - connectUs));
+            }
+        }
+        if (firstByteUs > 0) {
+            timeToFirstByte.record(nanos(firstByteUs - pretransferUs));
+        }
+    }
+    
+    HttpClient::EndpointStatistics snapshot() const {
+        HttpClient::EndpointStatistics result;
+        result.endpoint = endpoint;
+        result.requests = requests.load(std::memory_order_relaxed);
+        result.failures = failures.load(std::memory_order_relaxed);
+        result.attempts = attempts.load(std::memory_order_relaxed);
+        result.bytesSent = bytesSent.load(std::memory_order_relaxed);
+        result.bytesReceived = bytesReceived.load(std::memory_order_relaxed);
+        result.compressedBytes = compressedBytes.load(std::memory_order_relaxed);
+        result.uncompressedBytes = uncompressedBytes.load(std::memory_order_relaxed);
+        result.latency = latency.snapshot();
+        result.nameLookup = nameLookup.snapshot();
+        result.connect = connect.snapshot();
+        result.tlsHandshake = tlsHandshake.snapshot();
+        result.timeToFirstByte = timeToFirstByte.snapshot();
+        return result;
+    }
+    
+    void reset() {
+        requests.store(0, std::memory_order_relaxed);
+        failures.store(0, std::memory_order_relaxed);
+        attempts.store(0, std::memory_order_relaxed);
+        bytesSent.store(0, std::memory_order_relaxed);
+        bytesReceived.store(0, std::memory_order_relaxed);
+        compressedBytes.store(0, std::memory_order_relaxed);
+        uncompressedBytes.store(0, std::memory_order_relaxed);
+        latency.reset();
+        nameLookup.reset();
+        connect.reset();
+        tlsHandshake.reset();
+        timeToFirstByte.reset();
+    }
+};
+
+// Open-addressed table of endpoint stats. Entries are published with a CAS
+// and never removed, so lookups take no lock; once the table is full, new
+// keys share one "(other)" entry.
+class EndpointRegistry {
+private:
+    static constexpr size_t SLOTS = 256;
+    
+    std::array<std::atomic<EndpointStats*>, SLOTS> slots_{};
+    EndpointStats overflow_{"(other)"};
+
+public:
+    EndpointRegistry() = default;
+    EndpointRegistry(const EndpointRegistry&) = delete;
+    EndpointRegistry& operator=(const EndpointRegistry&) = delete;
+    
+    ~EndpointRegistry() {
+        for (auto& slot : slots_) {
+            delete slot.load(std::memory_order_relaxed);
+        }
+    }
+    
+    EndpointStats& find(const std::string& key) {
+        size_t hash = std::hash<std::string>{}(key);
+        for (size_t probe = 0; probe < SLOTS; ++probe) {
+            auto& slot = slots_[(hash + probe) % SLOTS];
+            EndpointStats* entry = slot.load(std::memory_order_acquire);
+            if (!entry) {
+                auto fresh = std::make_unique<EndpointStats>(key);
+                if (slot.compare_exchange_strong(entry, fresh.get(), std::memory_order_acq_rel)) {
+                    return *fresh.release();
+                }
+            }
+            if (entry->endpoint == key) {
+                return *entry;
+            }
+        }
+        return overflow_;
+    }
+    
+    template<typename Visit>
+    void forEach(Visit&& visit) {
+        for (auto& slot : slots_) {
+            if (auto* entry = slot.load(std::memory_order_acquire)) {
+                visit(*entry);
+            }
+        }
+        if (overflow_.requests.load(std::memory_order_relaxed) > 0) {
+            visit(overflow_);
+        }
+    }
+};
+
+// Everything about a request that does not depend on its parameters
+struct PreparedRequest::Route {
+    uint64_t ownerId = 0;
+    std::string method;
+    std::string endpoint;
+    std::string url;
+    std::shared_ptr<const CurlSlist> headers;
+    EndpointStats* stats = nullptr;
+    RateLimitCategory category = RateLimitCategory::STANDARD;
+    RequestPriority priority = RequestPriority::ACCOUNT;
+};
+
 class HttpClient::Impl {
 private:
+    using Route = PreparedRequest::Route;
+    
+    struct AsyncRequest {
+        std::shared_ptr<const Route> route;
+        std::string pathSuffix;
+        std::map<std::string, std::string> params;
+        HttpClient::CompletionHandler handler;
+        std::chrono::steady_clock::time_point start;
+        bool admitted = false;
+        int attempts = 0;
+    };
+    
+    // Lock-free counters behind HttpClient::Statistics
+    struct Counters {
+        std::atomic<uint64_t> totalRequests{0};
+        std::atomic<uint64_t> successfulRequests{0};
+        std::atomic<uint64_t> failedRequests{0};
+        std::atomic<uint64_t> rateLimitedRequests{0};
+        std::atomic<uint64_t> retriedRequests{0};
+        std::atomic<uint64_t> connectionsOpened{0};
+        std::atomic<uint64_t> http2Responses{0};
+        std::atomic<uint64_t> peakInFlight{0};
+        std::atomic<uint64_t> droppedRequests{0};
+        std::atomic<uint64_t> inFlight{0};
+        std::atomic<int64_t> totalLatencyNs{0};
+    };
+    
+    // Identifies this client to its PreparedRequests; unlike the address it
+    // is never reused once the client is destroyed
+    const uint64_t id_ = nextClientId();
     Config config_;
-    CurlHandle curlHandle_;
-    std::unique_ptr<RateLimiter> rateLimiter_;
-    bool rateLimitEnabled_ = false;
+    // Built once; every transfer points at one of these
+    std::shared_ptr<const CurlSlist> queryHeaders_;
+    std::shared_ptr<const CurlSlist> formHeaders_;
+    CurlShare share_;
+    CurlHandlePool handlePool_;
+    // Indexed by RateLimitCategory; categories the user configured explicitly
+    // keep their rate when the server reports a different allowance
+    std::array<std::unique_ptr<RateLimiter>, 3> rateLimiters_;
+    std::array<std::atomic<bool>, 3> rateLimitPinned_{};
+    std::atomic<bool> rateLimitEnabled_{false};
     
 
     int maxRetries_ = 3;
     std::chrono::milliseconds initialRetryDelay_{1000};
     double backoffMultiplier_ = 2.0;
-    bool retriesEnabled_ = false;
+    std::atomic<bool> retriesEnabled_{false};
     
 
-    mutable std::mutex statsMutex_;
-    HttpClient::Statistics stats_;
+    mutable Counters counters_;
+    mutable EndpointRegistry endpoints_;
+    
+    RequestScheduler scheduler_;
+    std::atomic<bool> schedulingEnabled_{false};
+    
+    // Declared last so the I/O thread stops before anything its completions touch
+    std::once_flag engineOnce_;
+    std::unique_ptr<CurlMultiEngine> engine_;
+    
+    static uint64_t nextClientId() {
+        static std::atomic<uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
     
 public:
     explicit Impl(const Config& config) 
         : config_(config), 
-          rateLimiter_(std::make_unique<RateLimiter>(60, std::chrono::minutes(1))) {}
+          handlePool_(static_cast<size_t>(std::max(config.maxConnections, 1))),
+          rateLimiters_{
+              std::make_unique<RateLimiter>(config.sandboxMode ? 60 : 120, std::chrono::minutes(1)),
+              std::make_unique<RateLimiter>(config.sandboxMode ? 60 : 120, std::chrono::minutes(1)),
+              std::make_unique<RateLimiter>(60, std::chrono::minutes(1))} {
+        size_t slots = static_cast<size_t>(std::max(config.maxConnections, 1)) *
+                       static_cast<size_t>(config.http2 ? std::max(config.maxConcurrentStreams, 1) : 1);
+        queryHeaders_ = makeHeaderList(buildHeaders());
+        formHeaders_ = makeHeaderList(buildHeaders({{"Content-Type", "application/x-www-form-urlencoded"}}));
+        scheduler_.setMaxInFlight(slots);
+        scheduler_.setLimits(RequestPriority::QUOTES, std::max<size_t>(slots / 2, 1), std::chrono::seconds(2));
+        scheduler_.setLimits(RequestPriority::BULK, std::max<size_t>(slots / 4, 1), std::chrono::milliseconds(0));
+    }
     
     std::string buildUrl(const std::string& endpoint) const {
         std::string url = config_.baseUrl();
@@ -189,27 +912,24 @@ public:
         return headers;
     }
     
-    std::string urlEncode(const std::string& value) const {
-        CurlHandle encoder;
-        if (!encoder) {
-            throw ConnectionError("Failed to initialize CURL for URL encoding");
-        }
-        
-        std::unique_ptr<char, decltype(&curl_free)> encoded(
-            curl_easy_escape(encoder.get(), value.c_str(), static_cast<int>(value.length())),
-            &curl_free
-        );
-        
-        if (!encoded) {
-            throw ConnectionError("Failed to URL encode value");
+
+    void setRateLimit(int maxRequests, std::chrono::milliseconds windowDuration) {
+        for (auto category : {RateLimitCategory::STANDARD, RateLimitCategory::MARKET_DATA, RateLimitCategory::TRADING}) {
+            setRateLimit(category, maxRequests, windowDuration);
         }
-        
-        return std::string(encoded.get());
     }
     
-
-    void setRateLimit(int maxRequests, std::chrono::milliseconds windowDuration) {
-        rateLimiter_ = std::make_unique<RateLimiter>(maxRequests, windowDuration);
+    void setRateLimit(RateLimitCategory category, int maxRequests, std::chrono::milliseconds windowDuration) {
+        limiter(category).setRate(maxRequests, windowDuration);
+        rateLimitPinned_[static_cast<size_t>(category)] = true;
+    }
+    
+    void setPriorityLimits(RequestPriority priority, size_t maxInFlight, std::chrono::milliseconds maxQueueDelay) {
+        scheduler_.setLimits(priority, maxInFlight, maxQueueDelay);
+    }
+    
+    void enablePriorityScheduling(bool enabled) {
+        schedulingEnabled_ = enabled;
     }
     
     void enableRateLimit(bool enabled) {
@@ -227,131 +947,237 @@ public:
     }
     
     HttpClient::Statistics getStatistics() const {
-        std::lock_guard<std::mutex> lock(statsMutex_);
-        return stats_;
+        HttpClient::Statistics stats;
+        stats.totalRequests = counters_.totalRequests.load(std::memory_order_relaxed);
+        stats.successfulRequests = counters_.successfulRequests.load(std::memory_order_relaxed);
+        stats.failedRequests = counters_.failedRequests.load(std::memory_order_relaxed);
+        stats.rateLimitedRequests = counters_.rateLimitedRequests.load(std::memory_order_relaxed);
+        stats.retriedRequests = counters_.retriedRequests.load(std::memory_order_relaxed);
+        stats.connectionsOpened = counters_.connectionsOpened.load(std::memory_order_relaxed);
+        stats.http2Responses = counters_.http2Responses.load(std::memory_order_relaxed);
+        stats.peakInFlight = counters_.peakInFlight.load(std::memory_order_relaxed);
+        stats.droppedRequests = counters_.droppedRequests.load(std::memory_order_relaxed);
+        stats.totalLatency = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::nanoseconds(counters_.totalLatencyNs.load(std::memory_order_relaxed)));
+        stats.poolWaits = handlePool_.waits();
+        endpoints_.forEach([&stats](const EndpointStats& entry) {
+            stats.compressedBytesReceived += entry.compressedBytes.load(std::memory_order_relaxed);
+            stats.uncompressedBytesReceived += entry.uncompressedBytes.load(std::memory_order_relaxed);
+        });
+        return stats;
+    }
+    
+    std::vector<HttpClient::EndpointStatistics> getEndpointStatistics() const {
+        std::vector<HttpClient::EndpointStatistics> result;
+        endpoints_.forEach([&result](const EndpointStats& entry) {
+            result.push_back(entry.snapshot());
+        });
+        std::sort(result.begin(), result.end(),
+                  [](const auto& a, const auto& b) { return a.endpoint < b.endpoint; });
+        return result;
     }
     
     void resetStatistics() {
-        std::lock_guard<std::mutex> lock(statsMutex_);
-        stats_ = HttpClient::Statistics{};
+        counters_.totalRequests.store(0, std::memory_order_relaxed);
+        counters_.successfulRequests.store(0, std::memory_order_relaxed);
+        counters_.failedRequests.store(0, std::memory_order_relaxed);
+        counters_.rateLimitedRequests.store(0, std::memory_order_relaxed);
+        counters_.retriedRequests.store(0, std::memory_order_relaxed);
+        counters_.connectionsOpened.store(0, std::memory_order_relaxed);
+        counters_.http2Responses.store(0, std::memory_order_relaxed);
+        counters_.peakInFlight.store(counters_.inFlight.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters_.droppedRequests.store(0, std::memory_order_relaxed);
+        counters_.totalLatencyNs.store(0, std::memory_order_relaxed);
+        endpoints_.forEach([](EndpointStats& entry) { entry.reset(); });
+        handlePool_.resetWaits();
     }
     
-    Response performRequest(const std::string& method, const std::string& endpoint, 
-                          const std::map<std::string, std::string>& params) {
-        auto start = std::chrono::steady_clock::now();
-        
-
-        {
-            std::lock_guard<std::mutex> lock(statsMutex_);
-            stats_.totalRequests++;
+    static std::shared_ptr<const CurlSlist> makeHeaderList(const Headers& headers) {
+        auto list = std::make_shared<CurlSlist>();
+        for (const auto& [key, value] : headers) {
+            list->append(key + ": " + value);
         }
-        
-
-        if (rateLimitEnabled_ && rateLimiter_) {
-            if (!rateLimiter_->tryAcquire()) {
-                {
-                    std::lock_guard<std::mutex> lock(statsMutex_);
-                    stats_.rateLimitedRequests++;
-                }
-                rateLimiter_->waitForSlot();
+        return list;
+    }
+    
+    // A trailing '/' stands for an id appended per call, so a prepared
+    // "/accounts/VA1/orders/" shares stats with "/accounts/VA1/orders/42"
+    // Extra headers, e.g. If-None-Match, give the route its own header list
+    Route makeRoute(const std::string& method, const std::string& endpoint, const Headers& extraHeaders = {}) {
+        Route route;
+        route.ownerId = id_;
+        route.method = method;
+        route.endpoint = endpoint;
+        route.url = buildUrl(endpoint);
+        route.headers = method == "POST" || method == "PUT" ? formHeaders_ : queryHeaders_;
+        if (!extraHeaders.empty()) {
+            auto headers = extraHeaders;
+            if (method == "POST" || method == "PUT") {
+                headers.emplace("Content-Type", "application/x-www-form-urlencoded");
             }
+            route.headers = makeHeaderList(buildHeaders(headers));
         }
+        route.stats = &endpoints_.find(endpointKey(method, !endpoint.empty() && endpoint.back() == '/' ?
+                                                           endpoint + "{id}" : endpoint));
+        route.category = HttpClient::rateLimitCategory(method, endpoint);
+        route.priority = HttpClient::requestPriority(method, endpoint);
+        return route;
+    }
+    
+    std::shared_ptr<const Route> prepare(const std::string& method, const std::string& endpoint) {
+        return std::make_shared<const Route>(makeRoute(method, endpoint));
+    }
+    
+    const Route& checkRoute(const std::shared_ptr<const Route>& route) const {
+        if (!route || route->ownerId != id_) {
+            throw ValidationError("PreparedRequest was not prepared by this HttpClient");
+        }
+        return *route;
+    }
+    
+    std::unique_ptr<Transfer> makeTransfer(const Route& route, std::string_view pathSuffix,
+                                           const std::map<std::string, std::string>& params) {
+        auto transfer = std::make_unique<Transfer>();
+        transfer->method = route.method;
+        transfer->url.reserve(route.url.size() + pathSuffix.size() + 64);
+        transfer->url = route.url;
+        transfer->url += pathSuffix;
+        transfer->headers = route.headers;
+        transfer->timeoutSeconds = static_cast<long>(config_.timeoutSeconds);
+        transfer->share = share_.get();
+        transfer->http2 = config_.http2;
+        transfer->compress = config_.compressResponses;
         
-        auto performSingleRequest = [&]() -> Response {
-            if (!curlHandle_) {
-                throw ConnectionError("CURL handle not initialized");
-            }
-            
-            curlHandle_.reset();
-        
-        std::string url = buildUrl(endpoint);
-        std::string postData;
-        
-        if (method == "GET" || method == "DELETE") {
+        if (route.method == "GET" || route.method == "DELETE") {
             if (!params.empty()) {
-                url += "?";
-                bool first = true;
-                for (const auto& [key, value] : params) {
-                    if (!first) url += "&";
-                    url += utils::urlEncode(key) + "=" + utils::urlEncode(value);
-                    first = false;
-                }
+                transfer->url += "?";
+                utils::appendUrlEncodedParams(transfer->url, params);
             }
         } else {
-            if (!params.empty()) {
-                bool first = true;
-                for (const auto& [key, value] : params) {
-                    if (!first) postData += "&";
-                    postData += urlEncode(key) + "=" + urlEncode(value);
-                    first = false;
-                }
-            }
+            utils::appendUrlEncodedParams(transfer->postData, params);
         }
         
-        std::string responseBody;
-        Headers responseHeaders;
+        return transfer;
+    }
+    
+    Response performSingleRequest(const Route& route, std::string_view pathSuffix,
+                                  const std::map<std::string, std::string>& params, EndpointStats& stats,
+                                  const HttpClient::BodyHandler& onBody) {
+        auto transfer = makeTransfer(route, pathSuffix, params);
+        transfer->bodyHandler = onBody;
         
-        curl_easy_setopt(curlHandle_.get(), CURLOPT_URL, url.c_str());
-        curl_easy_setopt(curlHandle_.get(), CURLOPT_WRITEFUNCTION, writeCallback);
-        curl_easy_setopt(curlHandle_.get(), CURLOPT_WRITEDATA, &responseBody);
-        curl_easy_setopt(curlHandle_.get(), CURLOPT_HEADERFUNCTION, headerCallback);
-        curl_easy_setopt(curlHandle_.get(), CURLOPT_HEADERDATA, &responseHeaders);
-        curl_easy_setopt(curlHandle_.get(), CURLOPT_TIMEOUT, config_.timeoutSeconds);
+        if (config_.http2) {
+            return performOnEngine(std::move(transfer), stats);
+        }
         
-        if (method == "POST") {
-            curl_easy_setopt(curlHandle_.get(), CURLOPT_POST, 1L);
-            curl_easy_setopt(curlHandle_.get(), CURLOPT_POSTFIELDS, postData.c_str());
-        } else if (method == "PUT") {
-            curl_easy_setopt(curlHandle_.get(), CURLOPT_CUSTOMREQUEST, "PUT");
-            curl_easy_setopt(curlHandle_.get(), CURLOPT_POSTFIELDS, postData.c_str());
-        } else if (method == "DELETE") {
-            curl_easy_setopt(curlHandle_.get(), CURLOPT_CUSTOMREQUEST, "DELETE");
-        } else {
-            curl_easy_setopt(curlHandle_.get(), CURLOPT_HTTPGET, 1L);
+        auto curlHandle = handlePool_.acquire();
+        if (!*curlHandle) {
+            throw ConnectionError("CURL handle not initialized");
         }
         
-        CurlSlist headerList;
-        auto headers = buildHeaders(method == "POST" || method == "PUT" ? 
-            Headers{{"Content-Type", "application/x-www-form-urlencoded"}} : Headers{});
+        curlHandle->reset();
+        transfer->apply(curlHandle->get());
         
-        for (const auto& [key, value] : headers) {
-            headerList.append(key + ": " + value);
+        CURLcode res = curl_easy_perform(curlHandle->get());
+        if (transfer->bodyError) {
+            std::rethrow_exception(transfer->bodyError);
         }
-        curl_easy_setopt(curlHandle_.get(), CURLOPT_HTTPHEADER, headerList.get());
-        
-        CURLcode res = curl_easy_perform(curlHandle_.get());
         if (res != CURLE_OK) {
             throw ConnectionError(std::string("CURL error: ") + curl_easy_strerror(res));
         }
         
-        long statusCode;
-        curl_easy_getinfo(curlHandle_.get(), CURLINFO_RESPONSE_CODE, &statusCode);
+        recordTransferInfo(*transfer, curlHandle->get(), stats);
+        return transfer->toResponse(curlHandle->get());
+    }
+    
+    // Blocking calls in HTTP/2 mode run on the multi engine as well, since
+    // only transfers sharing its connection cache can share a connection
+    Response performOnEngine(std::unique_ptr<Transfer> transfer, EndpointStats& stats) {
+        auto promise = std::make_shared<std::promise<Response>>();
+        auto future = promise->get_future();
+        
+        bool accepted = engine().submit(std::move(transfer), std::chrono::milliseconds(0),
+            [this, promise, &stats](Transfer& transfer, CURL* handle, CURLcode result) {
+                if (transfer.bodyError) {
+                    promise->set_exception(transfer.bodyError);
+                    return;
+                }
+                if (result != CURLE_OK || !handle) {
+                    promise->set_exception(std::make_exception_ptr(
+                        ConnectionError(std::string("CURL error: ") + curl_easy_strerror(result))));
+                    return;
+                }
+                recordTransferInfo(transfer, handle, stats);
+                promise->set_value(transfer.toResponse(handle));
+            });
         
-            return {static_cast<int>(statusCode), std::move(responseBody), std::move(responseHeaders)};
-        };
+        if (!accepted) {
+            throw ConnectionError("HTTP engine is shutting down");
+        }
+        
+        return future.get();
+    }
+    
+    Response performRequest(const std::string& method, const std::string& endpoint, 
+                          const std::map<std::string, std::string>& params,
+                          const HttpClient::BodyHandler& onBody = {}, const Headers& headers = {}) {
+        auto start = std::chrono::steady_clock::now();
+        return performRoute(makeRoute(method, endpoint, headers), {}, params, start, onBody);
+    }
+    
+    Response performPrepared(const std::shared_ptr<const Route>& route, std::string_view pathSuffix,
+                             const std::map<std::string, std::string>& params) {
+        auto start = std::chrono::steady_clock::now();
+        return performRoute(checkRoute(route), pathSuffix, params, start);
+    }
+    
+    Response performRoute(const Route& route, std::string_view pathSuffix,
+                          const std::map<std::string, std::string>& params,
+                          std::chrono::steady_clock::time_point start,
+                          const HttpClient::BodyHandler& onBody = {}) {
+        EndpointStats& stats = *route.stats;
+        auto category = route.category;
+        auto priority = route.priority;
+        
+        countRequest(stats);
+        bool scheduled = schedulingEnabled_;
+        if (scheduled && !admit(priority)) {
+            recordCompletion(start, false, stats);
+            throw TimeoutError("Request to " + route.endpoint + std::string(pathSuffix) +
+                               " dropped after waiting in the scheduler queue");
+        }
+        SchedulerSlot slot{scheduled ? &scheduler_ : nullptr, priority};
+        
+        // A streamed body cannot be taken back, so once any of it has been
+        // delivered a failed transfer is not retried
+        size_t delivered = 0;
+        HttpClient::BodyHandler counted;
+        if (onBody) {
+            counted = [&delivered, &onBody](std::string_view chunk) {
+                delivered += chunk.size();
+                onBody(chunk);
+            };
+        }
         
-
         Response response;
         bool success = false;
         int attempts = 0;
         
-        while (!success && attempts <= (retriesEnabled_ ? maxRetries_ : 0)) {
+        while (!success && attempts <= maxAttempts()) {
             try {
-                response = performSingleRequest();
+                auto wait = reserveRateLimit(category);
+                if (wait.count() > 0) {
+                    std::this_thread::sleep_for(wait);
+                }
+                response = performSingleRequest(route, pathSuffix, params, stats, counted);
+                applyRateLimitFeedback(category, response);
                 
 
                 if (response.status >= 500 || response.status == 429) {
-                    if (attempts < (retriesEnabled_ ? maxRetries_ : 0)) {
-                        {
-                            std::lock_guard<std::mutex> lock(statsMutex_);
-                            stats_.retriedRequests++;
-                        }
+                    if (attempts < maxAttempts()) {
+                        countRetry();
                         attempts++;
-                        
-                        auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
-                            initialRetryDelay_ * std::pow(backoffMultiplier_, attempts - 1)
-                        );
-                        std::this_thread::sleep_for(delay);
+                        std::this_thread::sleep_for(backoffDelay(attempts));
                         continue;
                     }
                 }
@@ -359,41 +1185,309 @@ public:
                 success = true;
                 
             } catch (const ConnectionError&) {
-                if (attempts < (retriesEnabled_ ? maxRetries_ : 0)) {
-                    {
-                        std::lock_guard<std::mutex> lock(statsMutex_);
-                        stats_.retriedRequests++;
-                    }
+                if (attempts < maxAttempts() && delivered == 0) {
+                    countRetry();
                     attempts++;
-                    
-                    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
-                        initialRetryDelay_ * std::pow(backoffMultiplier_, attempts - 1)
-                    );
-                    std::this_thread::sleep_for(delay);
+                    std::this_thread::sleep_for(backoffDelay(attempts));
                 } else {
+                    recordCompletion(start, false, stats);
                     throw;
                 }
+            } catch (...) {
+                // Not retryable, e.g. thrown by a streaming body handler
+                recordCompletion(start, false, stats);
+                throw;
             }
         }
         
-        auto end = std::chrono::steady_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        recordCompletion(start, response.success(), stats);
+        return response;
+    }
+    
+    void performRequestAsync(const std::string& method, const std::string& endpoint,
+                             const std::map<std::string, std::string>& params,
+                             HttpClient::CompletionHandler handler, const Headers& headers = {}) {
+        auto start = std::chrono::steady_clock::now();
+        performRouteAsync(std::make_shared<const Route>(makeRoute(method, endpoint, headers)), {}, params,
+                          std::move(handler), start);
+    }
+    
+    void performPreparedAsync(const std::shared_ptr<const Route>& route, std::string_view pathSuffix,
+                              const std::map<std::string, std::string>& params,
+                              HttpClient::CompletionHandler handler) {
+        auto start = std::chrono::steady_clock::now();
+        checkRoute(route);
+        performRouteAsync(route, pathSuffix, params, std::move(handler), start);
+    }
+    
+    void performRouteAsync(std::shared_ptr<const Route> route, std::string_view pathSuffix,
+                           const std::map<std::string, std::string>& params,
+                           HttpClient::CompletionHandler handler, std::chrono::steady_clock::time_point start) {
+        auto request = std::make_shared<AsyncRequest>();
+        request->route = std::move(route);
+        request->pathSuffix = pathSuffix;
+        request->params = params;
+        request->handler = std::move(handler);
+        request->start = start;
+        
+        countRequest(*request->route->stats);
+        
+        if (!schedulingEnabled_) {
+            submitAttempt(request, std::chrono::milliseconds(0));
+            return;
+        }
         
+        scheduler_.submit(request->route->priority,
+            [this, request] {
+                request->admitted = true;
+                submitAttempt(request, std::chrono::milliseconds(0));
+            },
+            [this, request] {
+                counters_.droppedRequests.fetch_add(1, std::memory_order_relaxed);
+                finishAsync(request, Response{}, std::make_exception_ptr(TimeoutError(
+                    "Request to " + request->route->endpoint + request->pathSuffix +
+                    " dropped after waiting in the scheduler queue")));
+            });
+    }
 
-        {
-            std::lock_guard<std::mutex> lock(statsMutex_);
-            stats_.totalLatency += duration;
-            if (response.success()) {
-                stats_.successfulRequests++;
-            } else {
-                stats_.failedRequests++;
+private:
+    struct SchedulerSlot {
+        RequestScheduler* scheduler;
+        RequestPriority priority;
+        
+        ~SchedulerSlot() {
+            if (scheduler) {
+                scheduler->release(priority);
+            }
+        }
+    };
+    
+    // Blocks until the scheduler admits the request; false if it was dropped
+    bool admit(RequestPriority priority) {
+        struct Admission {
+            std::mutex mutex;
+            std::condition_variable ready;
+            bool started = false;
+            bool dropped = false;
+        };
+        auto admission = std::make_shared<Admission>();
+        auto signal = [admission](bool started) {
+            {
+                std::lock_guard<std::mutex> lock(admission->mutex);
+                (started ? admission->started : admission->dropped) = true;
             }
+            admission->ready.notify_one();
+        };
+        
+        auto id = scheduler_.submit(priority, [signal] { signal(true); }, [signal] { signal(false); });
+        auto settled = [&admission] { return admission->started || admission->dropped; };
+        auto maxDelay = scheduler_.maxQueueDelay(priority);
+        
+        std::unique_lock<std::mutex> lock(admission->mutex);
+        if (maxDelay.count() > 0 && !admission->ready.wait_for(lock, maxDelay, settled)) {
+            lock.unlock();
+            if (scheduler_.cancel(priority, id)) {
+                admission->dropped = true;
+            }
+            lock.lock();
         }
+        admission->ready.wait(lock, settled);
         
-        return response;
+        if (admission->dropped) {
+            counters_.droppedRequests.fetch_add(1, std::memory_order_relaxed);
+        }
+        return admission->started;
+    }
+    
+    int maxAttempts() const {
+        return retriesEnabled_ ? maxRetries_ : 0;
+    }
+    
+    std::chrono::milliseconds backoffDelay(int attempt) const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            initialRetryDelay_ * std::pow(backoffMultiplier_, attempt - 1)
+        );
+    }
+    
+    void countRequest(EndpointStats& stats) {
+        counters_.totalRequests.fetch_add(1, std::memory_order_relaxed);
+        stats.requests.fetch_add(1, std::memory_order_relaxed);
+        
+        uint64_t inFlight = counters_.inFlight.fetch_add(1, std::memory_order_relaxed) + 1;
+        uint64_t peak = counters_.peakInFlight.load(std::memory_order_relaxed);
+        while (inFlight > peak && !counters_.peakInFlight.compare_exchange_weak(peak, inFlight, std::memory_order_relaxed)) {}
+    }
+    
+    void recordTransferInfo(const Transfer& transfer, CURL* handle, EndpointStats& stats) {
+        long connects = 0;
+        long version = 0;
+        curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &connects);
+        curl_easy_getinfo(handle, CURLINFO_HTTP_VERSION, &version);
+        
+        counters_.connectionsOpened.fetch_add(static_cast<uint64_t>(connects), std::memory_order_relaxed);
+        if (version == CURL_HTTP_VERSION_2_0) {
+            counters_.http2Responses.fetch_add(1, std::memory_order_relaxed);
+        }
+        stats.recordAttempt(handle, connects > 0, transfer.streamedBytes + transfer.responseBody.size());
+    }
+    
+    void countRetry() {
+        counters_.retriedRequests.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    RateLimiter& limiter(RateLimitCategory category) {
+        return *rateLimiters_[static_cast<size_t>(category)];
+    }
+    
+    // Takes a token for one attempt and returns how long it must wait
+    std::chrono::nanoseconds reserveRateLimit(RateLimitCategory category) {
+        if (!rateLimitEnabled_) {
+            return std::chrono::nanoseconds(0);
+        }
+        auto wait = limiter(category).reserve();
+        if (wait.count() > 0) {
+            counters_.rateLimitedRequests.fetch_add(1, std::memory_order_relaxed);
+        }
+        return wait;
+    }
+    
+    void applyRateLimitFeedback(RateLimitCategory category, const Response& response) {
+        if (!rateLimitEnabled_) {
+            return;
+        }
+        
+        auto available = headerNumber(response.headers, "X-Ratelimit-Available");
+        if (!available && response.status != 429) {
+            return;
+        }
+        
+        auto& bucket = limiter(category);
+        auto allowed = headerNumber(response.headers, "X-Ratelimit-Allowed");
+        if (allowed && *allowed > 0 && *allowed != bucket.capacity() &&
+            !rateLimitPinned_[static_cast<size_t>(category)]) {
+            bucket.setRate(static_cast<int>(*allowed), bucket.window());
+        }
+        
+        // Expiry is the epoch millisecond the server's window resets; a 429
+        // without one holds the bucket for a full window
+        std::chrono::nanoseconds untilReset = bucket.window();
+        if (auto expiry = headerNumber(response.headers, "X-Ratelimit-Expiry")) {
+            untilReset = std::chrono::milliseconds(*expiry) - std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch());
+        } else if (response.status != 429) {
+            untilReset = std::chrono::nanoseconds(0);
+        }
+        
+        bucket.calibrate(response.status == 429 ? 0 : available.value_or(0), untilReset);
+    }
+    
+    void recordCompletion(std::chrono::steady_clock::time_point start, bool succeeded, EndpointStats& stats) {
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        
+        counters_.inFlight.fetch_sub(1, std::memory_order_relaxed);
+        counters_.totalLatencyNs.fetch_add(duration, std::memory_order_relaxed);
+        stats.latency.record(static_cast<uint64_t>(std::max<int64_t>(duration, 0)));
+        if (succeeded) {
+            counters_.successfulRequests.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            counters_.failedRequests.fetch_add(1, std::memory_order_relaxed);
+            stats.failures.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
+    CurlMultiEngine& engine() {
+        std::call_once(engineOnce_, [this] {
+            long maxStreams = config_.http2 ? std::max(config_.maxConcurrentStreams, 1) : 0;
+            engine_ = std::make_unique<CurlMultiEngine>(
+                static_cast<long>(std::max(config_.maxConnections, 1)), maxStreams);
+        });
+        return *engine_;
+    }
+    
+    void submitAttempt(const std::shared_ptr<AsyncRequest>& request, std::chrono::milliseconds delay) {
+        // Waiting for a token happens on the engine's timer heap, not here
+        auto wait = std::chrono::ceil<std::chrono::milliseconds>(reserveRateLimit(request->route->category));
+        delay = std::max(delay, wait);
+        
+        std::unique_ptr<Transfer> transfer;
+        try {
+            transfer = makeTransfer(*request->route, request->pathSuffix, request->params);
+        } catch (...) {
+            finishAsync(request, Response{}, std::current_exception());
+            return;
+        }
+        
+        bool accepted = engine().submit(std::move(transfer), delay,
+            [this, request](Transfer& transfer, CURL* handle, CURLcode result) {
+                onAttemptComplete(request, transfer, handle, result);
+            });
+        
+        if (!accepted) {
+            finishAsync(request, Response{},
+                std::make_exception_ptr(ConnectionError("HTTP engine is shutting down")));
+        }
+    }
+    
+    void onAttemptComplete(const std::shared_ptr<AsyncRequest>& request, Transfer& transfer,
+                           CURL* handle, CURLcode result) {
+        Response response{};
+        std::exception_ptr error;
+        
+        if (result != CURLE_OK || !handle) {
+            error = std::make_exception_ptr(
+                ConnectionError(std::string("CURL error: ") + curl_easy_strerror(result)));
+        } else {
+            recordTransferInfo(transfer, handle, *request->route->stats);
+            response = transfer.toResponse(handle);
+            applyRateLimitFeedback(request->route->category, response);
+        }
+        
+        bool retryable = error || response.status >= 500 || response.status == 429;
+        if (retryable && result != CURLE_ABORTED_BY_CALLBACK && request->attempts < maxAttempts()) {
+            countRetry();
+            request->attempts++;
+            submitAttempt(request, backoffDelay(request->attempts));
+            return;
+        }
+        
+        finishAsync(request, std::move(response), error);
+    }
+    
+    void finishAsync(const std::shared_ptr<AsyncRequest>& request, Response response, std::exception_ptr error) {
+        recordCompletion(request->start, !error && response.success(), *request->route->stats);
+        if (request->admitted) {
+            scheduler_.release(request->route->priority);
+        }
+        
+        if (request->handler) {
+            try {
+                request->handler(std::move(response), error);
+            } catch (...) {
+                // Handler exceptions must not escape onto the I/O thread
+            }
+        }
     }
 };
 
+namespace {
+    std::future<Response> completeIntoFuture(
+        const std::function<void(HttpClient::CompletionHandler)>& start) {
+        auto promise = std::make_shared<std::promise<Response>>();
+        auto future = promise->get_future();
+        
+        start([promise](Response&& response, std::exception_ptr error) {
+            if (error) {
+                promise->set_exception(error);
+            } else {
+                promise->set_value(std::move(response));
+            }
+        });
+        
+        return future;
+    }
+}
+
 HttpClient::HttpClient(const Config& config) : impl_(std::make_unique<Impl>(config)) {}
 
 HttpClient::~HttpClient() = default;
@@ -405,6 +1499,14 @@ Response HttpClient::get(const std::string& endpoint, const QueryParams& params)
     return impl_->performRequest("GET", endpoint, params);
 }
 
+Response HttpClient::get(const std::string& endpoint, const QueryParams& params, const Headers& headers) {
+    return impl_->performRequest("GET", endpoint, params, {}, headers);
+}
+
+Response HttpClient::getStreaming(const std::string& endpoint, const QueryParams& params, BodyHandler onBody) {
+    return impl_->performRequest("GET", endpoint, params, onBody);
+}
+
 Response HttpClient::post(const std::string& endpoint, const FormParams& params) {
     return impl_->performRequest("POST", endpoint, params);
 }
@@ -417,10 +1519,132 @@ Response HttpClient::del(const std::string& endpoint, const QueryParams& params)
     return impl_->performRequest("DELETE", endpoint, params);
 }
 
+void HttpClient::getAsync(const std::string& endpoint, const QueryParams& params, CompletionHandler handler) {
+    impl_->performRequestAsync("GET", endpoint, params, std::move(handler));
+}
+
+void HttpClient::getAsync(const std::string& endpoint, const QueryParams& params, const Headers& headers,
+                          CompletionHandler handler) {
+    impl_->performRequestAsync("GET", endpoint, params, std::move(handler), headers);
+}
+
+void HttpClient::postAsync(const std::string& endpoint, const FormParams& params, CompletionHandler handler) {
+    impl_->performRequestAsync("POST", endpoint, params, std::move(handler));
+}
+
+void HttpClient::putAsync(const std::string& endpoint, const FormParams& params, CompletionHandler handler) {
+    impl_->performRequestAsync("PUT", endpoint, params, std::move(handler));
+}
+
+void HttpClient::delAsync(const std::string& endpoint, const QueryParams& params, CompletionHandler handler) {
+    impl_->performRequestAsync("DELETE", endpoint, params, std::move(handler));
+}
+
+std::future<Response> HttpClient::getAsync(const std::string& endpoint, const QueryParams& params) {
+    return completeIntoFuture([&](CompletionHandler handler) {
+        getAsync(endpoint, params, std::move(handler));
+    });
+}
+
+std::future<Response> HttpClient::postAsync(const std::string& endpoint, const FormParams& params) {
+    return completeIntoFuture([&](CompletionHandler handler) {
+        postAsync(endpoint, params, std::move(handler));
+    });
+}
+
+std::future<Response> HttpClient::putAsync(const std::string& endpoint, const FormParams& params) {
+    return completeIntoFuture([&](CompletionHandler handler) {
+        putAsync(endpoint, params, std::move(handler));
+    });
+}
+
+std::future<Response> HttpClient::delAsync(const std::string& endpoint, const QueryParams& params) {
+    return completeIntoFuture([&](CompletionHandler handler) {
+        delAsync(endpoint, params, std::move(handler));
+    });
+}
+
+const std::string& PreparedRequest::method() const {
+    return route_->method;
+}
+
+const std::string& PreparedRequest::endpoint() const {
+    return route_->endpoint;
+}
+
+PreparedRequest HttpClient::prepare(const std::string& method, const std::string& endpoint) {
+    return PreparedRequest(impl_->prepare(method, endpoint));
+}
+
+Response HttpClient::execute(const PreparedRequest& request, const QueryParams& params, std::string_view pathSuffix) {
+    return impl_->performPrepared(request.route_, pathSuffix, params);
+}
+
+void HttpClient::executeAsync(const PreparedRequest& request, const QueryParams& params, CompletionHandler handler,
+                              std::string_view pathSuffix) {
+    impl_->performPreparedAsync(request.route_, pathSuffix, params, std::move(handler));
+}
+
+std::future<Response> HttpClient::executeAsync(const PreparedRequest& request, const QueryParams& params,
+                                               std::string_view pathSuffix) {
+    return completeIntoFuture([&](CompletionHandler handler) {
+        executeAsync(request, params, std::move(handler), pathSuffix);
+    });
+}
+
 void HttpClient::setRateLimit(int maxRequestsPerWindow, std::chrono::milliseconds windowDuration) {
     impl_->setRateLimit(maxRequestsPerWindow, windowDuration);
 }
 
+void HttpClient::setRateLimit(RateLimitCategory category, int maxRequestsPerWindow,
+                              std::chrono::milliseconds windowDuration) {
+    impl_->setRateLimit(category, maxRequestsPerWindow, windowDuration);
+}
+
+RateLimitCategory HttpClient::rateLimitCategory(const std::string& method, const std::string& endpoint) {
+    std::string_view path(endpoint);
+    if (!path.empty() && path.front() == '/') {
+        path.remove_prefix(1);
+    }
+    
+    if (path.rfind("markets", 0) == 0) {
+        return RateLimitCategory::MARKET_DATA;
+    }
+    if (method != "GET" && path.rfind("accounts/", 0) == 0 && path.find("/orders") != std::string_view::npos) {
+        return RateLimitCategory::TRADING;
+    }
+    return RateLimitCategory::STANDARD;
+}
+
+void HttpClient::setPriorityLimits(RequestPriority priority, size_t maxInFlight,
+                                   std::chrono::milliseconds maxQueueDelay) {
+    impl_->setPriorityLimits(priority, maxInFlight, maxQueueDelay);
+}
+
+void HttpClient::enablePriorityScheduling(bool enabled) {
+    impl_->enablePriorityScheduling(enabled);
+}
+
+RequestPriority HttpClient::requestPriority(const std::string& method, const std::string& endpoint) {
+    if (rateLimitCategory(method, endpoint) == RateLimitCategory::TRADING) {
+        return RequestPriority::TRADING;
+    }
+    
+    std::string_view path(endpoint);
+    if (!path.empty() && path.front() == '/') {
+        path.remove_prefix(1);
+    }
+    
+    if (path.rfind("markets/history", 0) == 0 || path.rfind("markets/timesales", 0) == 0 ||
+        path.rfind("beta/markets/fundamentals", 0) == 0) {
+        return RequestPriority::BULK;
+    }
+    if (path.rfind("markets", 0) == 0 || path.rfind("beta/markets", 0) == 0) {
+        return RequestPriority::QUOTES;
+    }
+    return RequestPriority::ACCOUNT;
+}
+
 void HttpClient::enableRateLimit(bool enabled) {
     impl_->enableRateLimit(enabled);
 }
@@ -437,6 +1661,10 @@ HttpClient::Statistics HttpClient::getStatistics() const {
     return impl_->getStatistics();
 }
 
+std::vector<HttpClient::EndpointStatistics> HttpClient::getEndpointStatistics() const {
+    return impl_->getEndpointStatistics();
+}
+
 void HttpClient::resetStatistics() {
     impl_->resetStatistics();
 }
@@ -49,9 +49,8 @@ private:
     std::atomic<bool> connected_{false};
     std::atomic<bool> connecting_{false};
     std::atomic<bool> shouldStop_{false};
-    MessageCallback messageCallback_;
+    std::atomic<std::shared_ptr<const MessageCallback>> messageCallback_;
     std::thread ioThread_;
-    std::mutex callbackMutex_;
     std::mutex connectionMutex_;
     std::condition_variable connectionCv_;
     std::queue<std::string> pendingMessages_;
@@ -102,11 +101,11 @@ private:
         connectionCv_.notify_all();
     }
     
-    void onMessage(const std::string& msg) {
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        if (messageCallback_) {
+    void onMessage(std::string_view msg) {
+        auto callback = messageCallback_.load(std::memory_order_acquire);
+        if (callback && *callback) {
             try {
-                messageCallback_(msg);
+                (*callback)(msg);
             } catch (const std::exception& e) {
                 DEBUG_LOG(std::string("Message callback error: ") + e.what());
             }
@@ -164,15 +163,18 @@ private:
             
             onConnect();
             
+            // One buffer for the life of the connection; consume() keeps its
+            // capacity, so steady-state frames are read without allocating
+            beast::flat_buffer buffer;
+            
             // Start message reading loop
             while (!shouldStop_.load(std::memory_order_acquire) && ws_->is_open()) {
-                beast::flat_buffer buffer;
-                
                 // This will block until a message is received
                 ws_->read(buffer);
                 
-                std::string message = beast::buffers_to_string(buffer.data());
-                onMessage(message);
+                auto data = buffer.cdata();
+                onMessage(std::string_view(static_cast<const char*>(data.data()), data.size()));
+                buffer.consume(buffer.size());
             }
             
         } catch (const std::exception& e) {
@@ -310,8 +312,8 @@ public:
     }
     
     void setMessageHandler(MessageCallback callback) {
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        messageCallback_ = std::move(callback);
+        messageCallback_.store(std::make_shared<const MessageCallback>(std::move(callback)),
+                               std::memory_order_release);
     }
     
     void setAuthToken(const std::string& token) {
@@ -250,6 +250,207 @@ std::vector<OptionChain> parseOptionChains(const nlohmann::json& json) {
     return options;
 }
 
+namespace {
+
+// Builds OptionChainColumns from SAX events. Only options.option (an array
+// of records, or a single record) and each record's greeks object are read;
+// everything else is skipped.
+class OptionChainColumnsSax : public nlohmann::json_sax<nlohmann::json> {
+private:
+    enum class Scope : uint8_t { ROOT, OPTIONS, OPTION_LIST, RECORD, GREEKS, OTHER };
+    
+    OptionChainColumns& columns_;
+    std::vector<Scope> scopes_;
+    std::string key_;
+    
+    Scope top() const {
+        return scopes_.empty() ? Scope::OTHER : scopes_.back();
+    }
+    
+    Scope childScope(bool isObject) const {
+        if (scopes_.empty()) {
+            return isObject ? Scope::ROOT : Scope::OTHER;
+        }
+        switch (scopes_.back()) {
+            case Scope::ROOT:
+                return isObject && key_ == "options" ? Scope::OPTIONS : Scope::OTHER;
+            case Scope::OPTIONS:
+                if (key_ != "option") return Scope::OTHER;
+                return isObject ? Scope::RECORD : Scope::OPTION_LIST;
+            case Scope::OPTION_LIST:
+                return isObject ? Scope::RECORD : Scope::OTHER;
+            case Scope::RECORD:
+                return isObject && key_ == "greeks" ? Scope::GREEKS : Scope::OTHER;
+            default:
+                return Scope::OTHER;
+        }
+    }
+    
+    void beginRecord() {
+        columns_.strike.push_back(0.0);
+        columns_.bid.push_back(0.0);
+        columns_.ask.push_back(0.0);
+        columns_.last.push_back(0.0);
+        columns_.change.push_back(0.0);
+        columns_.volume.push_back(0);
+        columns_.openInterest.push_back(0);
+        columns_.bidSize.push_back(0);
+        columns_.askSize.push_back(0);
+        columns_.contractSize.push_back(100);
+        columns_.right.push_back(OptionRight::UNKNOWN);
+        columns_.delta.push_back(0.0);
+        columns_.gamma.push_back(0.0);
+        columns_.theta.push_back(0.0);
+        columns_.vega.push_back(0.0);
+        columns_.rho.push_back(0.0);
+        columns_.bidIv.push_back(0.0);
+        columns_.midIv.push_back(0.0);
+        columns_.askIv.push_back(0.0);
+        columns_.smvVol.push_back(0.0);
+        columns_.validity.push_back(0);
+        columns_.symbolOffsets.push_back(static_cast<uint32_t>(columns_.symbolPool.size()));
+    }
+    
+    void recordNumber(double value) {
+        size_t row = columns_.size() - 1;
+        if (key_ == "strike") {
+            columns_.strike[row] = value;
+        } else if (key_ == "bid") {
+            columns_.bid[row] = value;
+        } else if (key_ == "ask") {
+            columns_.ask[row] = value;
+        } else if (key_ == "last") {
+            columns_.last[row] = value;
+            columns_.validity[row] |= OptionChainColumns::HAS_LAST;
+        } else if (key_ == "change") {
+            columns_.change[row] = value;
+            columns_.validity[row] |= OptionChainColumns::HAS_CHANGE;
+        } else if (key_ == "volume") {
+            columns_.volume[row] = static_cast<int32_t>(value);
+        } else if (key_ == "open_interest") {
+            columns_.openInterest[row] = static_cast<int32_t>(value);
+        } else if (key_ == "bidsize") {
+            columns_.bidSize[row] = static_cast<int32_t>(value);
+        } else if (key_ == "asksize") {
+            columns_.askSize[row] = static_cast<int32_t>(value);
+        } else if (key_ == "contract_size") {
+            columns_.contractSize[row] = static_cast<int32_t>(value);
+        }
+    }
+    
+    void recordString(const std::string& value) {
+        size_t row = columns_.size() - 1;
+        if (key_ == "symbol") {
+            // Records carry one symbol; a repeated key replaces the pooled text
+            columns_.symbolPool.resize(columns_.symbolOffsets.back());
+            columns_.symbolPool += value;
+        } else if (key_ == "option_type") {
+            columns_.right[row] = value == "call" ? OptionRight::CALL
+                                : value == "put" ? OptionRight::PUT
+                                : OptionRight::UNKNOWN;
+        } else if (key_ == "underlying") {
+            if (columns_.underlying.empty()) columns_.underlying = value;
+        } else if (key_ == "expiration_date") {
+            if (columns_.expirationDate.empty()) columns_.expirationDate = value;
+        }
+    }
+    
+    void greeksNumber(double value) {
+        size_t row = columns_.size() - 1;
+        if (key_ == "delta") {
+            columns_.delta[row] = value;
+        } else if (key_ == "gamma") {
+            columns_.gamma[row] = value;
+        } else if (key_ == "theta") {
+            columns_.theta[row] = value;
+        } else if (key_ == "vega") {
+            columns_.vega[row] = value;
+        } else if (key_ == "rho") {
+            columns_.rho[row] = value;
+        } else if (key_ == "bid_iv") {
+            columns_.bidIv[row] = value;
+        } else if (key_ == "mid_iv") {
+            columns_.midIv[row] = value;
+        } else if (key_ == "ask_iv") {
+            columns_.askIv[row] = value;
+        } else if (key_ == "smv_vol") {
+            columns_.smvVol[row] = value;
+        }
+    }
+    
+    bool number(double value) {
+        if (top() == Scope::RECORD) {
+            recordNumber(value);
+        } else if (top() == Scope::GREEKS) {
+            greeksNumber(value);
+        }
+        return true;
+    }
+    
+    bool open(bool isObject) {
+        Scope scope = childScope(isObject);
+        if (scope == Scope::RECORD) {
+            beginRecord();
+        } else if (scope == Scope::GREEKS) {
+            columns_.validity.back() |= OptionChainColumns::HAS_GREEKS;
+        }
+        scopes_.push_back(scope);
+        return true;
+    }
+    
+    bool close() {
+        if (top() == Scope::RECORD) {
+            columns_.symbolOffsets.back() = static_cast<uint32_t>(columns_.symbolPool.size());
+        }
+        scopes_.pop_back();
+        return true;
+    }
+
+public:
+    explicit OptionChainColumnsSax(OptionChainColumns& columns) : columns_(columns) {}
+    
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t value) override { return number(static_cast<double>(value)); }
+    bool number_unsigned(number_unsigned_t value) override { return number(static_cast<double>(value)); }
+    bool number_float(number_float_t value, const string_t&) override { return number(value); }
+    bool binary(binary_t&) override { return true; }
+    
+    bool string(string_t& value) override {
+        if (top() == Scope::RECORD) {
+            recordString(value);
+        }
+        return true;
+    }
+    
+    bool key(string_t& value) override {
+        key_ = value;
+        return true;
+    }
+    
+    bool start_object(std::size_t) override { return open(true); }
+    bool end_object() override { return close(); }
+    bool start_array(std::size_t) override { return open(false); }
+    bool end_array() override { return close(); }
+    
+    bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& error) override {
+        throw std::runtime_error("Option chain parse error at byte " + std::to_string(position) + ": " + error.what());
+    }
+};
+
+}
+
+OptionChainColumns parseOptionChainColumns(std::string_view body) {
+    OptionChainColumns columns;
+    // Roughly 700 bytes per contract with greeks; only a capacity hint
+    columns.reserve(body.size() / 700);
+    columns.symbolOffsets.push_back(0);
+    
+    OptionChainColumnsSax handler(columns);
+    nlohmann::json::sax_parse(body.begin(), body.end(), &handler);
+    return columns;
+}
+
 std::vector<double> parseStrikes(const nlohmann::json& json) {
     std::vector<double> strikes;
     if (!json.is_null() && json.is_object() && json.contains("strikes") && !json["strikes"].is_null() && json["strikes"].contains("strike") && !json["strikes"]["strike"].is_null()) {
@@ -432,6 +633,147 @@ std::vector<Security> parseSecurities(const nlohmann::json& json) {
     return securities;
 }
 
+namespace {
+
+// Fills one flat row from SAX events: top-level scalars go to Fields by key
+// and nested values are skipped. Streamed rows arrive one at a time, where a
+// DOM per row would cost more than the row itself.
+template<typename Row, typename Fields>
+class FlatRowSax : public nlohmann::json_sax<nlohmann::json> {
+private:
+    Row& row_;
+    std::string key_;
+    int depth_ = 0;
+    
+    bool number(double value) {
+        if (depth_ == 1) {
+            Fields::number(row_, key_, value);
+        }
+        return true;
+    }
+
+public:
+    explicit FlatRowSax(Row& row) : row_(row) {}
+    
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t value) override { return number(static_cast<double>(value)); }
+    bool number_unsigned(number_unsigned_t value) override { return number(static_cast<double>(value)); }
+    bool number_float(number_float_t value, const string_t&) override { return number(value); }
+    bool binary(binary_t&) override { return true; }
+    
+    bool string(string_t& value) override {
+        if (depth_ == 1) {
+            Fields::string(row_, key_, value);
+        }
+        return true;
+    }
+    
+    bool key(string_t& value) override {
+        if (depth_ == 1) {
+            key_ = value;
+        }
+        return true;
+    }
+    
+    bool start_object(std::size_t) override { ++depth_; return true; }
+    bool end_object() override { --depth_; return true; }
+    bool start_array(std::size_t) override { ++depth_; return true; }
+    bool end_array() override { --depth_; return true; }
+    
+    bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& error) override {
+        throw std::runtime_error("Row parse error at byte " + std::to_string(position) + ": " + error.what());
+    }
+};
+
+template<typename Row, typename Fields>
+Row parseFlatRow(std::string_view text) {
+    Row row;
+    FlatRowSax<Row, Fields> handler(row);
+    nlohmann::json::sax_parse(text.begin(), text.end(), &handler);
+    return row;
+}
+
+struct HistoricalDataFields {
+    static void number(HistoricalData& row, const std::string& key, double value) {
+        if (key == "open") {
+            row.open = value;
+        } else if (key == "high") {
+            row.high = value;
+        } else if (key == "low") {
+            row.low = value;
+        } else if (key == "close") {
+            row.close = value;
+        } else if (key == "volume") {
+            row.volume = static_cast<long>(value);
+        }
+    }
+    
+    static void string(HistoricalData& row, const std::string& key, std::string& value) {
+        if (key == "date") {
+            row.date = std::move(value);
+        }
+    }
+};
+
+struct TimeSalesFields {
+    static void number(TimeSalesData& row, const std::string& key, double value) {
+        if (key == "timestamp") {
+            row.timestamp = static_cast<long>(value);
+        } else if (key == "price") {
+            row.price = value;
+        } else if (key == "open") {
+            row.open = value;
+        } else if (key == "high") {
+            row.high = value;
+        } else if (key == "low") {
+            row.low = value;
+        } else if (key == "close") {
+            row.close = value;
+        } else if (key == "volume") {
+            row.volume = static_cast<long>(value);
+        } else if (key == "vwap") {
+            row.vwap = value;
+        }
+    }
+    
+    static void string(TimeSalesData& row, const std::string& key, std::string& value) {
+        if (key == "time") {
+            row.time = std::move(value);
+        }
+    }
+};
+
+struct SecurityFields {
+    static void number(Security&, const std::string&, double) {}
+    
+    static void string(Security& row, const std::string& key, std::string& value) {
+        if (key == "symbol") {
+            row.symbol = std::move(value);
+        } else if (key == "exchange") {
+            row.exchange = std::move(value);
+        } else if (key == "type") {
+            row.type = std::move(value);
+        } else if (key == "description") {
+            row.description = std::move(value);
+        }
+    }
+};
+
+}
+
+HistoricalData parseHistoricalDataRow(std::string_view row) {
+    return parseFlatRow<HistoricalData, HistoricalDataFields>(row);
+}
+
+TimeSalesData parseTimeSalesRow(std::string_view row) {
+    return parseFlatRow<TimeSalesData, TimeSalesFields>(row);
+}
+
+Security parseSecurityRow(std::string_view row) {
+    return parseFlatRow<Security, SecurityFields>(row);
+}
+
 SessionTime parseSessionTime(const nlohmann::json& json) {
     SessionTime session;
     if (!json.is_null() && json.is_object()) {
@@ -0,0 +1,169 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include "tradier/json/record_stream.hpp"
+#include <stdexcept>
+
+namespace tradier {
+namespace json {
+
+RecordStream::RecordStream(std::vector<std::string> path, RecordHandler onRecord)
+    : path_(std::move(path)), onRecord_(std::move(onRecord)) {
+    if (path_.empty()) {
+        throw std::invalid_argument("RecordStream needs at least one key in its path");
+    }
+}
+
+void RecordStream::feed(std::string_view chunk) {
+    // Start of the current record within this chunk, or npos
+    size_t captureFrom = recordDepth_ > 0 ? 0 : std::string_view::npos;
+    
+    for (size_t i = 0; i < chunk.size(); ++i) {
+        char c = chunk[i];
+        
+        if (inString_) {
+            if (escape_) {
+                escape_ = false;
+            } else if (c == '\\') {
+                escape_ = true;
+            } else if (c == '"') {
+                inString_ = false;
+                if (capturingKey_) {
+                    capturingKey_ = false;
+                    auto& frame = stack_.back();
+                    frame.keyMatched = key_ == path_[static_cast<size_t>(frame.level)];
+                }
+            } else if (capturingKey_) {
+                key_ += c;
+            }
+            continue;
+        }
+        
+        switch (c) {
+            case '"': {
+                inString_ = true;
+                if (recordDepth_ == 0 && !stack_.empty()) {
+                    auto& frame = stack_.back();
+                    if (frame.object && frame.expectKey && frame.level >= 0) {
+                        capturingKey_ = true;
+                        key_.clear();
+                    }
+                }
+                break;
+            }
+            case ':':
+                if (!stack_.empty()) {
+                    stack_.back().expectKey = false;
+                }
+                break;
+            case ',':
+                if (!stack_.empty() && stack_.back().object) {
+                    stack_.back().expectKey = true;
+                    stack_.back().keyMatched = false;
+                }
+                break;
+            case '{':
+            case '[':
+                open(c, i, captureFrom);
+                break;
+            case '}':
+            case ']':
+                close(c, chunk, i, captureFrom);
+                break;
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                break;
+            default:
+                if (done_ || !started_) {
+                    throw std::runtime_error("Unexpected content outside the JSON document");
+                }
+                break;
+        }
+    }
+    
+    if (captureFrom != std::string_view::npos) {
+        record_.append(chunk.substr(captureFrom));
+    }
+}
+
+void RecordStream::open(char c, size_t position, size_t& captureFrom) {
+    bool object = c == '{';
+    
+    if (stack_.empty()) {
+        if (done_ || started_) {
+            throw std::runtime_error("Unexpected content after the JSON document");
+        }
+        started_ = true;
+        stack_.push_back({object, object, false, false, object ? 0 : -1});
+        return;
+    }
+    
+    if (recordDepth_ > 0) {
+        stack_.push_back({object, object, false, false, -1});
+        return;
+    }
+    
+    const Frame parent = stack_.back();
+    bool startsRecord = false;
+    int level = -1;
+    bool target = false;
+    
+    if (parent.object && parent.level >= 0 && parent.keyMatched && !parent.expectKey) {
+        auto next = static_cast<size_t>(parent.level) + 1;
+        if (next < path_.size()) {
+            level = object ? static_cast<int>(next) : -1;
+        } else if (object) {
+            startsRecord = true;
+        } else {
+            target = true;
+        }
+    } else if (parent.target) {
+        startsRecord = object;
+    }
+    
+    stack_.push_back({object, object, false, target, level});
+    if (startsRecord) {
+        recordDepth_ = stack_.size();
+        record_.clear();
+        captureFrom = position;
+    }
+}
+
+void RecordStream::close(char c, std::string_view chunk, size_t position, size_t& captureFrom) {
+    if (stack_.empty() || stack_.back().object != (c == '}')) {
+        throw std::runtime_error("Mismatched bracket in JSON document");
+    }
+    
+    stack_.pop_back();
+    
+    if (recordDepth_ > 0 && stack_.size() < recordDepth_) {
+        record_.append(chunk.substr(captureFrom, position + 1 - captureFrom));
+        captureFrom = std::string_view::npos;
+        recordDepth_ = 0;
+        records_++;
+        onRecord_(record_);
+    }
+    
+    if (stack_.empty()) {
+        done_ = true;
+    }
+}
+
+void RecordStream::finish() const {
+    if (!done_) {
+        throw std::runtime_error("JSON document ended before it was complete");
+    }
+}
+
+}
+}
\ No newline at end of file
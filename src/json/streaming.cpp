@@ -12,6 +12,9 @@
 #include "tradier/json/streaming.hpp"
 #include "tradier/common/json_utils.hpp"
 
+#include <array>
+#include <charconv>
+
 namespace tradier {
 namespace json {
 
@@ -35,5 +38,543 @@ StreamSession parseStreamSession(const nlohmann::json& json) {
     return session;
 }
 
+namespace {
+
+struct StreamValue {
+    enum class Kind { STRING, NUMBER, TRUE_LITERAL, FALSE_LITERAL, NULL_LITERAL };
+    
+    Kind kind = Kind::NULL_LITERAL;
+    std::string_view text;    // raw, still escaped when `escaped` is set
+    double number = 0.0;
+    bool escaped = false;
+};
+
+struct StreamField {
+    std::string_view key;
+    StreamValue value;
+};
+
+// Tradier frames carry well under this many fields
+constexpr size_t MAX_STREAM_FIELDS = 32;
+
+class FlatObjectScanner {
+private:
+    const char* pos_;
+    const char* end_;
+    
+    void skipWhitespace() {
+        while (pos_ < end_ && (*pos_ == ' ' || *pos_ == '\t' || *pos_ == '\n' || *pos_ == '\r')) {
+            ++pos_;
+        }
+    }
+    
+    bool consume(char c) {
+        skipWhitespace();
+        if (pos_ < end_ && *pos_ == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+    
+    bool consumeLiteral(std::string_view literal) {
+        if (static_cast<size_t>(end_ - pos_) < literal.size() ||
+            std::string_view(pos_, literal.size()) != literal) {
+            return false;
+        }
+        pos_ += literal.size();
+        return true;
+    }
+    
+    bool scanString(std::string_view& out, bool& escaped) {
+        if (pos_ >= end_ || *pos_ != '"') {
+            return false;
+        }
+        const char* start = ++pos_;
+        escaped = false;
+        while (pos_ < end_) {
+            char c = *pos_;
+            if (c == '"') {
+                out = std::string_view(start, static_cast<size_t>(pos_ - start));
+                ++pos_;
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) {
+                return false;
+            }
+            if (c == '\\') {
+                escaped = true;
+                if (++pos_ >= end_) {
+                    return false;
+                }
+            }
+            ++pos_;
+        }
+        return false;
+    }
+    
+    bool scanValue(StreamValue& value) {
+        skipWhitespace();
+        if (pos_ >= end_) {
+            return false;
+        }
+        
+        switch (*pos_) {
+            case '"':
+                value.kind = StreamValue::Kind::STRING;
+                return scanString(value.text, value.escaped);
+            case 't':
+                value.kind = StreamValue::Kind::TRUE_LITERAL;
+                return consumeLiteral("true");
+            case 'f':
+                value.kind = StreamValue::Kind::FALSE_LITERAL;
+                return consumeLiteral("false");
+            case 'n':
+                value.kind = StreamValue::Kind::NULL_LITERAL;
+                return consumeLiteral("null");
+            default:
+                break;
+        }
+        
+        if (*pos_ != '-' && (*pos_ < '0' || *pos_ > '9')) {
+            return false;
+        }
+        
+        auto [ptr, ec] = std::from_chars(pos_, end_, value.number);
+        if (ec != std::errc()) {
+            return false;
+        }
+        value.kind = StreamValue::Kind::NUMBER;
+        value.text = std::string_view(pos_, static_cast<size_t>(ptr - pos_));
+        pos_ = ptr;
+        return true;
+    }
+
+public:
+    explicit FlatObjectScanner(std::string_view input)
+        : pos_(input.data()), end_(input.data() + input.size()) {}
+    
+    bool scan(std::array<StreamField, MAX_STREAM_FIELDS>& fields, size_t& count) {
+        count = 0;
+        if (!consume('{')) {
+            return false;
+        }
+        
+        if (!consume('}')) {
+            do {
+                if (count == fields.size()) {
+                    return false;
+                }
+                
+                StreamField& field = fields[count++];
+                field.value = StreamValue{};
+                bool escapedKey = false;
+                skipWhitespace();
+                if (!scanString(field.key, escapedKey) || escapedKey ||
+                    !consume(':') || !scanValue(field.value)) {
+                    return false;
+                }
+            } while (consume(','));
+            
+            if (!consume('}')) {
+                return false;
+            }
+        }
+        
+        skipWhitespace();
+        return pos_ == end_;
+    }
+};
+
+// Mirrors StreamingService's parseNumericField: numbers as-is, numeric
+// strings parsed, anything else falls back to the default
+double numericValue(const StreamValue& value) {
+    if (value.kind == StreamValue::Kind::NUMBER) {
+        return value.number;
+    }
+    if (value.kind == StreamValue::Kind::STRING && !value.escaped && !value.text.empty()) {
+        const char* first = value.text.data();
+        const char* last = first + value.text.size();
+        while (first < last && (*first == ' ' || *first == '\t')) {
+            ++first;
+        }
+        if (first < last && *first == '+') {
+            ++first;
+        }
+        double result = 0.0;
+        if (std::from_chars(first, last, result).ec == std::errc()) {
+            return result;
+        }
+    }
+    return 0.0;
+}
+
+bool isPlainString(const StreamValue& value) {
+    return value.kind == StreamValue::Kind::STRING && !value.escaped;
+}
+
+// json.value() throws on a present value of the wrong type (null included),
+// so those frames, like escaped text, are reported as unsupported and take
+// the full-parse path
+bool assignString(std::string& target, const StreamValue& value) {
+    if (!isPlainString(value)) {
+        return false;
+    }
+    target.assign(value.text);
+    return true;
+}
+
+bool assignBool(bool& target, const StreamValue& value) {
+    if (value.kind != StreamValue::Kind::TRUE_LITERAL && value.kind != StreamValue::Kind::FALSE_LITERAL) {
+        return false;
+    }
+    target = value.kind == StreamValue::Kind::TRUE_LITERAL;
+    return true;
+}
+
+bool decodeTrade(const StreamField* fields, size_t count, TradeEvent& event) {
+    event.exchange.clear();
+    event.price = 0.0;
+    event.size = 0;
+    event.cvol = 0;
+    event.date.clear();
+    event.last = 0.0;
+    
+    for (size_t i = 0; i < count; ++i) {
+        const auto& [key, value] = fields[i];
+        if (key == "exch") {
+            if (!assignString(event.exchange, value)) return false;
+        } else if (key == "price") {
+            event.price = numericValue(value);
+        } else if (key == "size") {
+            event.size = static_cast<int>(numericValue(value));
+        } else if (key == "cvol") {
+            event.cvol = static_cast<long>(numericValue(value));
+        } else if (key == "last") {
+            event.last = numericValue(value);
+        } else if (key == "date") {
+            if (!assignString(event.date, value)) return false;
+        }
+    }
+    return true;
+}
+
+bool decodeQuote(const StreamField* fields, size_t count, QuoteEvent& event) {
+    event.bid = 0.0;
+    event.bidSize = 0;
+    event.bidExchange.clear();
+    event.bidDate.clear();
+    event.ask = 0.0;
+    event.askSize = 0;
+    event.askExchange.clear();
+    event.askDate.clear();
+    
+    for (size_t i = 0; i < count; ++i) {
+        const auto& [key, value] = fields[i];
+        if (key == "bid") {
+            event.bid = numericValue(value);
+        } else if (key == "ask") {
+            event.ask = numericValue(value);
+        } else if (key == "bidsz") {
+            event.bidSize = static_cast<int>(numericValue(value));
+        } else if (key == "asksz") {
+            event.askSize = static_cast<int>(numericValue(value));
+        } else if (key == "bidexch") {
+            if (!assignString(event.bidExchange, value)) return false;
+        } else if (key == "biddate") {
+            if (!assignString(event.bidDate, value)) return false;
+        } else if (key == "askexch") {
+            if (!assignString(event.askExchange, value)) return false;
+        } else if (key == "askdate") {
+            if (!assignString(event.askDate, value)) return false;
+        }
+    }
+    return true;
+}
+
+bool decodeSummary(const StreamField* fields, size_t count, SummaryEvent& event) {
+    event.open = 0.0;
+    event.high = 0.0;
+    event.low = 0.0;
+    event.prevClose = 0.0;
+    
+    for (size_t i = 0; i < count; ++i) {
+        const auto& [key, value] = fields[i];
+        if (key == "open") {
+            event.open = numericValue(value);
+        } else if (key == "high") {
+            event.high = numericValue(value);
+        } else if (key == "low") {
+            event.low = numericValue(value);
+        } else if (key == "prevClose") {
+            event.prevClose = numericValue(value);
+        }
+    }
+    return true;
+}
+
+bool decodeTimesale(const StreamField* fields, size_t count, TimesaleEvent& event) {
+    event.exchange.clear();
+    event.bid = 0.0;
+    event.ask = 0.0;
+    event.last = 0.0;
+    event.size = 0;
+    event.date.clear();
+    event.seq = 0;
+    event.flag.clear();
+    event.cancel = false;
+    event.correction = false;
+    event.session.clear();
+    
+    for (size_t i = 0; i < count; ++i) {
+        const auto& [key, value] = fields[i];
+        if (key == "exch") {
+            if (!assignString(event.exchange, value)) return false;
+        } else if (key == "bid") {
+            event.bid = numericValue(value);
+        } else if (key == "ask") {
+            event.ask = numericValue(value);
+        } else if (key == "last") {
+            event.last = numericValue(value);
+        } else if (key == "size") {
+            event.size = static_cast<int>(numericValue(value));
+        } else if (key == "seq") {
+            event.seq = static_cast<int>(numericValue(value));
+        } else if (key == "date") {
+            if (!assignString(event.date, value)) return false;
+        } else if (key == "flag") {
+            if (!assignString(event.flag, value)) return false;
+        } else if (key == "cancel") {
+            if (!assignBool(event.cancel, value)) return false;
+        } else if (key == "correction") {
+            if (!assignBool(event.correction, value)) return false;
+        } else if (key == "session") {
+            if (!assignString(event.session, value)) return false;
+        }
+    }
+    return true;
+}
+
+}
+
+StreamDecodeStatus decodeStreamEvent(std::string_view message, StreamEventBuffer& out) {
+    std::array<StreamField, MAX_STREAM_FIELDS> fields;
+    size_t count = 0;
+    
+    FlatObjectScanner scanner(message);
+    if (!scanner.scan(fields, count)) {
+        return StreamDecodeStatus::UNSUPPORTED;
+    }
+    
+    const StreamValue* type = nullptr;
+    const StreamValue* symbol = nullptr;
+    const StreamValue* exchange = nullptr;
+    for (size_t i = 0; i < count; ++i) {
+        const auto& key = fields[i].key;
+        if (key == "type") {
+            type = &fields[i].value;
+        } else if (key == "symbol") {
+            symbol = &fields[i].value;
+        } else if (key == "exch") {
+            exchange = &fields[i].value;
+        }
+    }
+    
+    if (!type) {
+        return StreamDecodeStatus::IGNORED;
+    }
+    if (!isPlainString(*type) || (symbol && !isPlainString(*symbol)) || (exchange && !isPlainString(*exchange))) {
+        return StreamDecodeStatus::UNSUPPORTED;
+    }
+    
+    const std::string_view symbolText = symbol ? symbol->text : std::string_view{};
+    out.hasExchange = exchange != nullptr;
+    out.exchange.assign(exchange ? exchange->text : std::string_view{});
+    
+    const std::string_view typeText = type->text;
+    if (typeText == "trade") {
+        out.trade.type.assign(typeText);
+        out.trade.symbol.assign(symbolText);
+        return decodeTrade(fields.data(), count, out.trade)
+            ? StreamDecodeStatus::TRADE : StreamDecodeStatus::UNSUPPORTED;
+    }
+    if (typeText == "quote") {
+        out.quote.type.assign(typeText);
+        out.quote.symbol.assign(symbolText);
+        return decodeQuote(fields.data(), count, out.quote)
+            ? StreamDecodeStatus::QUOTE : StreamDecodeStatus::UNSUPPORTED;
+    }
+    if (typeText == "summary") {
+        out.summary.type.assign(typeText);
+        out.summary.symbol.assign(symbolText);
+        return decodeSummary(fields.data(), count, out.summary)
+            ? StreamDecodeStatus::SUMMARY : StreamDecodeStatus::UNSUPPORTED;
+    }
+    if (typeText == "timesale") {
+        out.timesale.type.assign(typeText);
+        out.timesale.symbol.assign(symbolText);
+        return decodeTimesale(fields.data(), count, out.timesale)
+            ? StreamDecodeStatus::TIMESALE : StreamDecodeStatus::UNSUPPORTED;
+    }
+    
+    return StreamDecodeStatus::IGNORED;
+}
+
+namespace {
+
+int64_t epochMillis(const StreamValue& value) {
+    if (value.kind == StreamValue::Kind::NUMBER) {
+        return static_cast<int64_t>(value.number);
+    }
+    int64_t result = 0;
+    if (isPlainString(value)) {
+        std::from_chars(value.text.data(), value.text.data() + value.text.size(), result);
+    }
+    return result;
+}
+
+char codeValue(const StreamValue& value) {
+    return isPlainString(value) && !value.text.empty() ? value.text.front() : '\0';
+}
+
+TradingSession sessionValue(const StreamValue& value) {
+    if (isPlainString(value)) {
+        if (value.text == "pre") return TradingSession::PRE;
+        if (value.text == "normal") return TradingSession::NORMAL;
+        if (value.text == "post") return TradingSession::POST;
+    }
+    return TradingSession::UNKNOWN;
+}
+
+void decodeCompactTrade(const StreamField* fields, size_t count, CompactTradeEvent& event) {
+    for (size_t i = 0; i < count; ++i) {
+        const auto& [key, value] = fields[i];
+        if (key == "exch") {
+            event.exchange = codeValue(value);
+        } else if (key == "price") {
+            event.price = numericValue(value);
+        } else if (key == "size") {
+            event.size = static_cast<int32_t>(numericValue(value));
+        } else if (key == "cvol") {
+            event.cvol = static_cast<int64_t>(numericValue(value));
+        } else if (key == "last") {
+            event.last = numericValue(value);
+        } else if (key == "date") {
+            event.timestampMs = epochMillis(value);
+        }
+    }
+}
+
+void decodeCompactQuote(const StreamField* fields, size_t count, CompactQuoteEvent& event) {
+    for (size_t i = 0; i < count; ++i) {
+        const auto& [key, value] = fields[i];
+        if (key == "bid") {
+            event.bid = numericValue(value);
+        } else if (key == "ask") {
+            event.ask = numericValue(value);
+        } else if (key == "bidsz") {
+            event.bidSize = static_cast<int32_t>(numericValue(value));
+        } else if (key == "asksz") {
+            event.askSize = static_cast<int32_t>(numericValue(value));
+        } else if (key == "bidexch") {
+            event.bidExchange = codeValue(value);
+        } else if (key == "biddate") {
+            event.bidTimeMs = epochMillis(value);
+        } else if (key == "askexch") {
+            event.askExchange = codeValue(value);
+        } else if (key == "askdate") {
+            event.askTimeMs = epochMillis(value);
+        }
+    }
+}
+
+void decodeCompactTimesale(const StreamField* fields, size_t count, CompactTimesaleEvent& event) {
+    for (size_t i = 0; i < count; ++i) {
+        const auto& [key, value] = fields[i];
+        if (key == "exch") {
+            event.exchange = codeValue(value);
+        } else if (key == "bid") {
+            event.bid = numericValue(value);
+        } else if (key == "ask") {
+            event.ask = numericValue(value);
+        } else if (key == "last") {
+            event.last = numericValue(value);
+        } else if (key == "size") {
+            event.size = static_cast<int32_t>(numericValue(value));
+        } else if (key == "seq") {
+            event.seq = static_cast<int32_t>(numericValue(value));
+        } else if (key == "date") {
+            event.timestampMs = epochMillis(value);
+        } else if (key == "flag") {
+            event.flag = codeValue(value);
+        } else if (key == "cancel") {
+            event.cancel = value.kind == StreamValue::Kind::TRUE_LITERAL;
+        } else if (key == "correction") {
+            event.correction = value.kind == StreamValue::Kind::TRUE_LITERAL;
+        } else if (key == "session") {
+            event.session = sessionValue(value);
+        }
+    }
+}
+
+}
+
+StreamDecodeStatus decodeCompactStreamEvent(std::string_view message, SymbolTable& symbols, CompactEventBuffer& out) {
+    std::array<StreamField, MAX_STREAM_FIELDS> fields;
+    size_t count = 0;
+    
+    FlatObjectScanner scanner(message);
+    if (!scanner.scan(fields, count)) {
+        return StreamDecodeStatus::UNSUPPORTED;
+    }
+    
+    const StreamValue* type = nullptr;
+    const StreamValue* symbol = nullptr;
+    const StreamValue* exchange = nullptr;
+    for (size_t i = 0; i < count; ++i) {
+        const auto& key = fields[i].key;
+        if (key == "type") {
+            type = &fields[i].value;
+        } else if (key == "symbol") {
+            symbol = &fields[i].value;
+        } else if (key == "exch") {
+            exchange = &fields[i].value;
+        }
+    }
+    
+    if (!type) {
+        return StreamDecodeStatus::IGNORED;
+    }
+    if (!isPlainString(*type) || (symbol && !isPlainString(*symbol)) || (exchange && !isPlainString(*exchange))) {
+        return StreamDecodeStatus::UNSUPPORTED;
+    }
+    
+    out.symbol = symbol ? symbol->text : std::string_view{};
+    out.hasExchange = exchange != nullptr;
+    out.exchange = exchange ? exchange->text : std::string_view{};
+    
+    const std::string_view typeText = type->text;
+    if (typeText == "trade") {
+        out.trade = CompactTradeEvent{};
+        out.trade.symbol = symbols.intern(out.symbol);
+        decodeCompactTrade(fields.data(), count, out.trade);
+        return StreamDecodeStatus::TRADE;
+    }
+    if (typeText == "quote") {
+        out.quote = CompactQuoteEvent{};
+        out.quote.symbol = symbols.intern(out.symbol);
+        decodeCompactQuote(fields.data(), count, out.quote);
+        return StreamDecodeStatus::QUOTE;
+    }
+    if (typeText == "timesale") {
+        out.timesale = CompactTimesaleEvent{};
+        out.timesale.symbol = symbols.intern(out.symbol);
+        decodeCompactTimesale(fields.data(), count, out.timesale);
+        return StreamDecodeStatus::TIMESALE;
+    }
+    
+    return StreamDecodeStatus::IGNORED;
+}
+
+}
 }
-}
\ No newline at end of file
@@ -12,77 +12,596 @@
 #include "tradier/market.hpp"
 #include "tradier/client.hpp"
 #include "tradier/common/errors.hpp"
+#include "tradier/common/http_client.hpp"
 #include "tradier/common/json_utils.hpp"
 #include "tradier/common/api_result.hpp"
 #include "tradier/common/async.hpp"
+#include "tradier/common/single_flight.hpp"
+#include "tradier/common/response_cache.hpp"
 #include "tradier/json/market.hpp"
+#include "tradier/json/record_stream.hpp"
 
 #include <iostream>
 #include <sstream>
 
 namespace tradier {
 
-Result<std::vector<Quote>> MarketService::getQuotes(const std::vector<std::string>& symbols, bool greeks) {
-    return tryExecute<std::vector<Quote>>([&]() -> std::vector<Quote> {
-        if (symbols.empty()) {
-            throw ValidationError("Symbols list cannot be empty");
+void OptionChainColumns::reserve(size_t rows) {
+    for (auto* column : {&strike, &bid, &ask, &last, &change,
+                         &delta, &gamma, &theta, &vega, &rho,
+                         &bidIv, &midIv, &askIv, &smvVol}) {
+        column->reserve(rows);
+    }
+    for (auto* column : {&volume, &openInterest, &bidSize, &askSize, &contractSize}) {
+        column->reserve(rows);
+    }
+    right.reserve(rows);
+    validity.reserve(rows);
+    symbolOffsets.reserve(rows + 1);
+    // OCC option symbols are at most 21 characters
+    symbolPool.reserve(rows * 21);
+}
+
+void OptionChainColumns::clear() {
+    for (auto* column : {&strike, &bid, &ask, &last, &change,
+                         &delta, &gamma, &theta, &vega, &rho,
+                         &bidIv, &midIv, &askIv, &smvVol}) {
+        column->clear();
+    }
+    for (auto* column : {&volume, &openInterest, &bidSize, &askSize, &contractSize}) {
+        column->clear();
+    }
+    right.clear();
+    validity.clear();
+    symbolOffsets.clear();
+    symbolPool.clear();
+    underlying.clear();
+    expirationDate.clear();
+}
+
+namespace {
+
+// A market data request split into what to send and how to decode the reply,
+// so the blocking and the non-blocking paths share one definition per endpoint.
+template<typename T>
+struct MarketCall {
+    std::string method = "GET";
+    std::string endpoint;
+    std::map<std::string, std::string> params;
+    std::function<T(const Response&)> decode;
+};
+
+template<typename T>
+std::function<T(const Response&)> decodeWith(T (*parser)(const nlohmann::json&),
+                                             std::string failureMessage,
+                                             std::string parseFailureMessage) {
+    return [parser, failureMessage = std::move(failureMessage),
+            parseFailureMessage = std::move(parseFailureMessage)](const Response& response) -> T {
+        if (!response.success()) {
+            throw ::tradier::ApiError(response.status, failureMessage + ": " + response.body);
         }
         
-        std::ostringstream symbolsStr;
-        for (size_t i = 0; i < symbols.size(); ++i) {
-            if (i > 0) symbolsStr << ",";
-            symbolsStr << symbols[i];
+        auto parsed = json::parseResponse<T>(response, parser);
+        if (!parsed) {
+            throw std::runtime_error(parseFailureMessage);
         }
         
-        QueryParams params;
-        params["symbols"] = symbolsStr.str();
-        params["greeks"] = greeks ? "true" : "false";
+        return std::move(*parsed);
+    };
+}
+
+std::string joinSymbols(const std::vector<std::string>& symbols) {
+    std::ostringstream symbolsStr;
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        if (i > 0) symbolsStr << ",";
+        symbolsStr << symbols[i];
+    }
+    return symbolsStr.str();
+}
+
+// Identifies a GET for coalescing. The operation name is part of the key
+// because calls sharing an endpoint can decode to different types.
+template<typename T>
+std::string flightKey(const std::string& operation, const MarketCall<T>& call) {
+    std::string key = operation;
+    key += '\0';
+    key += call.endpoint;
+    for (const auto& [name, value] : call.params) {
+        key += '\0';
+        key += name;
+        key += '=';
+        key += value;
+    }
+    return key;
+}
+
+// A call's place in the reference-data cache: no cache for endpoints without
+// a TTL, otherwise the key and whatever entry lookup() found for it
+struct CacheSlot {
+    std::shared_ptr<ResponseCache> cache;
+    std::string key;
+    std::chrono::milliseconds ttl{0};
+    std::optional<ResponseCache::Entry> entry;
+    
+    bool fresh() const { return entry && entry->fresh; }
+    Headers conditionalHeaders() const { return entry ? entry->conditionalHeaders() : Headers{}; }
+};
+
+template<typename T>
+CacheSlot cacheSlot(TradierClient& client, const std::string& operation, const MarketCall<T>& call) {
+    CacheSlot slot;
+    const auto& cache = client.responseCache();
+    if (!cache || call.method != "GET") {
+        return slot;
+    }
+    
+    slot.ttl = cache->ttl(call.endpoint);
+    if (slot.ttl.count() > 0) {
+        slot.cache = cache;
+        slot.key = flightKey(operation, call);
+        slot.entry = cache->lookup(slot.key);
+    }
+    return slot;
+}
+
+// Decodes a reply, reusing the cached value on 304 Not Modified and caching
+// a freshly decoded one
+template<typename T>
+std::shared_ptr<const T> decodeCached(const MarketCall<T>& call, const Response& response, const CacheSlot& slot) {
+    if (slot.cache && slot.entry && response.status == 304) {
+        slot.cache->refresh(slot.key, *slot.entry, response.headers, slot.ttl);
+        return std::static_pointer_cast<const T>(slot.entry->value);
+    }
+    
+    auto value = std::make_shared<const T>(call.decode(response));
+    if (slot.cache) {
+        slot.cache->store(slot.key, value, response.headers, response.body.size(), slot.ttl);
+    }
+    return value;
+}
+
+template<typename T>
+Result<T> runCall(TradierClient& client, const std::function<MarketCall<T>()>& build, const std::string& operation) {
+    return tryExecute<T>([&]() -> T {
+        auto call = build();
         
-        auto response = client_.get("/markets/quotes", params);
+        if (call.method == "POST") {
+            return call.decode(client.post(call.endpoint, call.params));
+        }
         
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get quotes: " + response.body);
+        auto slot = cacheSlot(client, operation, call);
+        if (slot.fresh()) {
+            return *std::static_pointer_cast<const T>(slot.entry->value);
         }
         
-        auto parsed = json::parseResponse<std::vector<Quote>>(response, json::parseQuotes);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse quotes response");
+        const auto& coalescer = client.requestCoalescer();
+        if (!coalescer && !slot.cache) {
+            return call.decode(client.get(call.endpoint, call.params));
         }
         
-        return *parsed;
-    }, "getQuotes");
+        auto fetch = [&] {
+            return decodeCached(call, client.getHttpClient().get(call.endpoint, call.params, slot.conditionalHeaders()), slot);
+        };
+        if (!coalescer) {
+            return *fetch();
+        }
+        
+        // Callers joining an identical request share its response and its
+        // decoded value, each taking a copy
+        return *coalescer->run<T>(flightKey(operation, call), fetch);
+    }, operation);
 }
 
-
-Result<std::vector<Quote>> MarketService::getQuotesPost(const std::vector<std::string>& symbols, bool greeks) {
-    return tryExecute<std::vector<Quote>>([&]() -> std::vector<Quote> {
-        if (symbols.empty()) {
-            throw ValidationError("Symbols list cannot be empty");
+// Sends the request through the client's curl_multi engine and decodes the
+// reply on the shared ThreadPool, keeping JSON parsing off the I/O thread.
+// Only the HttpClient is referenced after return, never the MarketService.
+template<typename T>
+void runCallAsync(TradierClient& client, const std::function<MarketCall<T>()>& build,
+                  const std::string& operation, std::function<void(Result<T>)> callback) {
+    std::shared_ptr<MarketCall<T>> call;
+    auto prepared = tryExecute<bool>([&]() {
+        call = std::make_shared<MarketCall<T>>(build());
+        return true;
+    }, operation);
+    
+    if (!prepared) {
+        callback(Result<T>(prepared.error()));
+        return;
+    }
+    
+    auto slot = std::make_shared<const CacheSlot>(cacheSlot(client, operation, *call));
+    if (slot->fresh()) {
+        callback(tryExecute<T>([&]() -> T {
+            return *std::static_pointer_cast<const T>(slot->entry->value);
+        }, operation));
+        return;
+    }
+    
+    // With coalescing, the callback waits on the flight and only the leader
+    // sends the request; its decode completes the flight for everyone
+    std::shared_ptr<SingleFlight> coalescer;
+    std::string key;
+    if (call->method == "GET" && client.requestCoalescer()) {
+        coalescer = client.requestCoalescer();
+        key = flightKey(operation, *call);
+        bool leader = coalescer->join(key, [operation, callback](const SingleFlight::Value& value, std::exception_ptr error) {
+            auto result = tryExecute<T>([&]() -> T {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                return *std::static_pointer_cast<const T>(value);
+            }, operation);
+            try {
+                callback(std::move(result));
+            } catch (...) {
+                // A throwing user callback is dropped, as it is on the
+                // ThreadPool when the call is not coalesced
+            }
+        });
+        if (!leader) {
+            return;
         }
-        
-        std::ostringstream symbolsStr;
-        for (size_t i = 0; i < symbols.size(); ++i) {
-            if (i > 0) symbolsStr << ",";
-            symbolsStr << symbols[i];
+    }
+    
+    auto onResponse = [call, slot, operation, callback, coalescer, key](Response&& response, std::exception_ptr error) {
+        auto decode = [call, slot, operation, callback, coalescer, key, response = std::move(response), error]() {
+            if (coalescer) {
+                SingleFlight::Value value;
+                auto failure = error;
+                if (!failure) {
+                    try {
+                        value = decodeCached(*call, response, *slot);
+                    } catch (...) {
+                        failure = std::current_exception();
+                    }
+                }
+                coalescer->complete(key, std::move(value), failure);
+                return;
+            }
+            
+            callback(tryExecute<T>([&]() -> T {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                return slot->cache ? *decodeCached(*call, response, *slot) : call->decode(response);
+            }, operation));
+        };
+        
+        try {
+            ThreadPool::getInstance().enqueue(std::move(decode));
+        } catch (const std::exception&) {
+            decode();
+        }
+    };
+    
+    auto& http = client.getHttpClient();
+    if (call->method == "POST") {
+        http.postAsync(call->endpoint, call->params, std::move(onResponse));
+    } else if (slot->cache) {
+        http.getAsync(call->endpoint, call->params, slot->conditionalHeaders(), std::move(onResponse));
+    } else {
+        http.getAsync(call->endpoint, call->params, std::move(onResponse));
+    }
+}
+
+// Feeds the body to a RecordStream as curl receives it and parses each row
+// with a SAX pass; a failed response is reported through the call's decode
+template<typename T>
+Result<size_t> runStream(TradierClient& client, const std::function<MarketCall<std::vector<T>>()>& build,
+                         std::vector<std::string> path, T (*parser)(std::string_view),
+                         const std::function<void(const T&)>& onRow, const std::string& operation) {
+    return tryExecute<size_t>([&]() -> size_t {
+        if (!onRow) {
+            throw ValidationError("Row handler cannot be empty");
         }
         
-        FormParams params;
-        params["symbols"] = symbolsStr.str();
-        params["greeks"] = greeks ? "true" : "false";
-        
-        auto response = client_.post("/markets/quotes", params);
+        auto call = build();
+        json::RecordStream rows(std::move(path), [&](std::string_view row) {
+            onRow(parser(row));
+        });
         
+        auto response = client.getHttpClient().getStreaming(call.endpoint, call.params,
+            [&rows](std::string_view chunk) { rows.feed(chunk); });
         if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get quotes via POST: " + response.body);
+            call.decode(response);
         }
         
-        auto parsed = json::parseResponse<std::vector<Quote>>(response, json::parseQuotes);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse quotes POST response");
+        rows.finish();
+        return rows.records();
+    }, operation);
+}
+
+template<typename T>
+SimpleAsyncResult<T> runCallFuture(TradierClient& client, const std::function<MarketCall<T>()>& build,
+                                   const std::string& operation) {
+    auto promise = std::make_shared<std::promise<Result<T>>>();
+    auto future = promise->get_future();
+    
+    runCallAsync<T>(client, build, operation, [promise](Result<T> result) {
+        promise->set_value(std::move(result));
+    });
+    
+    return future;
+}
+
+MarketCall<std::vector<Quote>> quotesCall(const std::vector<std::string>& symbols, bool greeks, bool usePost) {
+    if (symbols.empty()) {
+        throw ValidationError("Symbols list cannot be empty");
+    }
+    
+    MarketCall<std::vector<Quote>> call;
+    call.method = usePost ? "POST" : "GET";
+    call.endpoint = "/markets/quotes";
+    call.params["symbols"] = joinSymbols(symbols);
+    call.params["greeks"] = greeks ? "true" : "false";
+    call.decode = usePost
+        ? decodeWith(json::parseQuotes, "Failed to get quotes via POST", "Failed to parse quotes POST response")
+        : decodeWith(json::parseQuotes, "Failed to get quotes", "Failed to parse quotes response");
+    return call;
+}
+
+MarketCall<Quote> quoteCall(const std::string& symbol, bool greeks) {
+    if (symbol.empty()) {
+        throw ValidationError("Symbol cannot be empty");
+    }
+    
+    auto quotes = quotesCall({symbol}, greeks, false);
+    
+    MarketCall<Quote> call;
+    call.method = quotes.method;
+    call.endpoint = quotes.endpoint;
+    call.params = std::move(quotes.params);
+    call.decode = [decodeQuotes = std::move(quotes.decode), symbol](const Response& response) -> Quote {
+        auto result = decodeQuotes(response);
+        if (result.empty()) {
+            throw ::tradier::ApiError(404, "No quote found for symbol: " + symbol);
         }
-        
-        return *parsed;
-    }, "getQuotesPost");
+        return result.front();
+    };
+    return call;
+}
+
+MarketCall<std::vector<OptionChain>> optionChainCall(const std::string& symbol, const std::string& expiration, bool greeks) {
+    if (symbol.empty()) {
+        throw ValidationError("Symbol cannot be empty");
+    }
+    if (expiration.empty()) {
+        throw ValidationError("Expiration date cannot be empty");
+    }
+    
+    MarketCall<std::vector<OptionChain>> call;
+    call.endpoint = "/markets/options/chains";
+    call.params["symbol"] = symbol;
+    call.params["expiration"] = expiration;
+    call.params["greeks"] = greeks ? "true" : "false";
+    call.decode = decodeWith(json::parseOptionChains, "Failed to get option chain", "Failed to parse option chain response");
+    return call;
+}
+
+MarketCall<OptionChainColumns> optionChainColumnsCall(const std::string& symbol, const std::string& expiration, bool greeks) {
+    auto chain = optionChainCall(symbol, expiration, greeks);
+    
+    MarketCall<OptionChainColumns> call;
+    call.endpoint = std::move(chain.endpoint);
+    call.params = std::move(chain.params);
+    call.decode = [](const Response& response) -> OptionChainColumns {
+        if (!response.success()) {
+            throw ::tradier::ApiError(response.status, "Failed to get option chain: " + response.body);
+        }
+        return json::parseOptionChainColumns(response.body);
+    };
+    return call;
+}
+
+MarketCall<std::vector<double>> optionStrikesCall(const std::string& symbol, const std::string& expiration, bool includeAllRoots) {
+    if (symbol.empty()) {
+        throw ValidationError("Symbol cannot be empty");
+    }
+    if (expiration.empty()) {
+        throw ValidationError("Expiration date cannot be empty");
+    }
+    
+    MarketCall<std::vector<double>> call;
+    call.endpoint = "/markets/options/strikes";
+    call.params["symbol"] = symbol;
+    call.params["expiration"] = expiration;
+    call.params["includeAllRoots"] = includeAllRoots ? "true" : "false";
+    call.decode = decodeWith(json::parseStrikes, "Failed to get option strikes", "Failed to parse option strikes response");
+    return call;
+}
+
+MarketCall<std::vector<Expiration>> optionExpirationsCall(const std::string& symbol, bool includeAllRoots, bool strikes, bool contractSize, bool expirationType) {
+    if (symbol.empty()) {
+        throw ValidationError("Symbol cannot be empty");
+    }
+    
+    MarketCall<std::vector<Expiration>> call;
+    call.endpoint = "/markets/options/expirations";
+    call.params["symbol"] = symbol;
+    call.params["includeAllRoots"] = includeAllRoots ? "true" : "false";
+    call.params["strikes"] = strikes ? "true" : "false";
+    call.params["contractSize"] = contractSize ? "true" : "false";
+    call.params["expirationType"] = expirationType ? "true" : "false";
+    call.decode = decodeWith(json::parseExpirations, "Failed to get option expirations", "Failed to parse option expirations response");
+    return call;
+}
+
+MarketCall<std::vector<OptionSymbol>> optionSymbolsCall(const std::string& underlying) {
+    if (underlying.empty()) {
+        throw ValidationError("Underlying symbol cannot be empty");
+    }
+    
+    MarketCall<std::vector<OptionSymbol>> call;
+    call.endpoint = "/markets/options/lookup";
+    call.params["underlying"] = underlying;
+    call.decode = decodeWith(json::parseOptionSymbols, "Failed to lookup option symbols", "Failed to parse option symbols response");
+    return call;
+}
+
+template<typename T>
+MarketCall<T> seriesCall(const std::string& endpoint, const std::string& symbol, const std::string& interval,
+                         const std::string& start, const std::string& end, const std::string& sessionFilter) {
+    if (symbol.empty()) {
+        throw ValidationError("Symbol cannot be empty");
+    }
+    
+    MarketCall<T> call;
+    call.endpoint = endpoint;
+    call.params["symbol"] = symbol;
+    call.params["interval"] = interval;
+    call.params["session_filter"] = sessionFilter;
+    
+    if (!start.empty()) {
+        call.params["start"] = start;
+    }
+    if (!end.empty()) {
+        call.params["end"] = end;
+    }
+    
+    return call;
+}
+
+MarketCall<std::vector<HistoricalData>> historicalDataCall(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
+    auto call = seriesCall<std::vector<HistoricalData>>("/markets/history", symbol, interval, start, end, sessionFilter);
+    call.decode = decodeWith(json::parseHistoricalDataList, "Failed to get historical data", "Failed to parse historical data response");
+    return call;
+}
+
+MarketCall<std::vector<TimeSalesData>> timeSalesCall(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
+    auto call = seriesCall<std::vector<TimeSalesData>>("/markets/timesales", symbol, interval, start, end, sessionFilter);
+    call.decode = decodeWith(json::parseTimeSalesList, "Failed to get time sales data", "Failed to parse time sales response");
+    return call;
+}
+
+MarketCall<std::vector<Security>> etbListCall() {
+    MarketCall<std::vector<Security>> call;
+    call.endpoint = "/markets/etb";
+    call.decode = decodeWith(json::parseSecurities, "Failed to get ETB list", "Failed to parse ETB list response");
+    return call;
+}
+
+MarketCall<MarketClock> clockCall(bool delayed) {
+    MarketCall<MarketClock> call;
+    call.endpoint = "/markets/clock";
+    if (delayed) {
+        call.params["delayed"] = "true";
+    }
+    call.decode = decodeWith(json::parseMarketClock, "Failed to get market clock", "Failed to parse market clock response");
+    return call;
+}
+
+MarketCall<MarketCalendar> calendarCall(const std::string& month, const std::string& year) {
+    MarketCall<MarketCalendar> call;
+    call.endpoint = "/markets/calendar";
+    if (!month.empty()) {
+        call.params["month"] = month;
+    }
+    if (!year.empty()) {
+        call.params["year"] = year;
+    }
+    call.decode = decodeWith(json::parseMarketCalendar, "Failed to get market calendar", "Failed to parse market calendar response");
+    return call;
+}
+
+MarketCall<std::vector<Security>> searchSymbolsCall(const std::string& query, bool indexes) {
+    if (query.empty()) {
+        throw ValidationError("Search query cannot be empty");
+    }
+    
+    MarketCall<std::vector<Security>> call;
+    call.endpoint = "/markets/search";
+    call.params["q"] = query;
+    call.params["indexes"] = indexes ? "true" : "false";
+    call.decode = decodeWith(json::parseSecurities, "Failed to search symbols", "Failed to parse symbol search response");
+    return call;
+}
+
+MarketCall<std::vector<Security>> lookupSymbolsCall(const std::string& query, const std::string& exchanges, const std::string& types) {
+    if (query.empty()) {
+        throw ValidationError("Search query cannot be empty");
+    }
+    
+    MarketCall<std::vector<Security>> call;
+    call.endpoint = "/markets/lookup";
+    call.params["q"] = query;
+    
+    if (!exchanges.empty()) {
+        call.params["exchanges"] = exchanges;
+    }
+    if (!types.empty()) {
+        call.params["types"] = types;
+    }
+    
+    call.decode = decodeWith(json::parseSecurities, "Failed to lookup symbols", "Failed to parse symbol lookup response");
+    return call;
+}
+
+template<typename T>
+MarketCall<T> fundamentalsCall(const std::string& endpoint, const std::string& symbol,
+                               T (*parser)(const nlohmann::json&),
+                               std::string failureMessage, std::string parseFailureMessage) {
+    if (symbol.empty()) {
+        throw ValidationError("Symbol cannot be empty");
+    }
+    
+    MarketCall<T> call;
+    call.endpoint = endpoint;
+    call.params["symbols"] = symbol;
+    call.decode = decodeWith(parser, std::move(failureMessage), std::move(parseFailureMessage));
+    return call;
+}
+
+MarketCall<CompanyFundamentals> companyInfoCall(const std::string& symbol) {
+    auto call = fundamentalsCall<CompanyFundamentals>("/beta/markets/fundamentals/company", symbol,
+        json::parseCompanyFundamentals, "Failed to get company info", "Failed to parse company fundamentals response");
+    
+    call.decode = [decode = std::move(call.decode)](const Response& response) {
+        if (response.status == 302) {
+            throw ::tradier::ApiError(response.status, "Company fundamentals endpoint redirected - feature unavailable");
+        }
+        return decode(response);
+    };
+    return call;
+}
+
+MarketCall<std::vector<CorporateCalendarEvent>> corporateCalendarCall(const std::string& symbol) {
+    return fundamentalsCall<std::vector<CorporateCalendarEvent>>("/beta/markets/fundamentals/calendars", symbol,
+        json::parseCorporateCalendar, "Failed to get corporate calendar", "Failed to parse corporate calendar response");
+}
+
+MarketCall<std::vector<Dividend>> dividendsCall(const std::string& symbol) {
+    return fundamentalsCall<std::vector<Dividend>>("/beta/markets/fundamentals/dividends", symbol,
+        json::parseDividends, "Failed to get dividends", "Failed to parse dividends response");
+}
+
+MarketCall<CorporateActions> corporateActionsCall(const std::string& symbol) {
+    return fundamentalsCall<CorporateActions>("/beta/markets/fundamentals/corporate_actions", symbol,
+        json::parseCorporateActions, "Failed to get corporate actions", "Failed to parse corporate actions response");
+}
+
+MarketCall<std::vector<FinancialRatios>> financialRatiosCall(const std::string& symbol) {
+    return fundamentalsCall<std::vector<FinancialRatios>>("/beta/markets/fundamentals/ratios", symbol,
+        json::parseFinancialRatios, "Failed to get financial ratios", "Failed to parse financial ratios response");
+}
+
+MarketCall<FinancialStatement> financialStatementsCall(const std::string& symbol) {
+    return fundamentalsCall<FinancialStatement>("/beta/markets/fundamentals/financials", symbol,
+        json::parseFinancialStatements, "Failed to get financial statements", "Failed to parse financial statements response");
+}
+
+MarketCall<PriceStatistics> priceStatisticsCall(const std::string& symbol) {
+    return fundamentalsCall<PriceStatistics>("/beta/markets/fundamentals/statistics", symbol,
+        json::parsePriceStatistics, "Failed to get price statistics", "Failed to parse price statistics response");
+}
+
+}
+
+Result<std::vector<Quote>> MarketService::getQuotes(const std::vector<std::string>& symbols, bool greeks) {
+    return runCall<std::vector<Quote>>(client_, [&] { return quotesCall(symbols, greeks, false); }, "getQuotes");
+}
+
+Result<std::vector<Quote>> MarketService::getQuotesPost(const std::vector<std::string>& symbols, bool greeks) {
+    return runCall<std::vector<Quote>>(client_, [&] { return quotesCall(symbols, greeks, true); }, "getQuotesPost");
 }
 
 Result<Quote> MarketService::getQuote(const std::string& symbol, bool greeks) {
@@ -100,609 +619,208 @@ Result<Quote> MarketService::getQuote(const std::string& symbol, bool greeks) {
 }
 
 Result<std::vector<OptionChain>> MarketService::getOptionChain(const std::string& symbol, const std::string& expiration, bool greeks) {
-    return tryExecute<std::vector<OptionChain>>([&]() -> std::vector<OptionChain> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        if (expiration.empty()) {
-            throw ValidationError("Expiration date cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbol"] = symbol;
-        params["expiration"] = expiration;
-        params["greeks"] = greeks ? "true" : "false";
-        
-        auto response = client_.get("/markets/options/chains", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get option chain: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<OptionChain>>(response, json::parseOptionChains);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse option chain response");
-        }
-        
-        return *parsed;
-    }, "getOptionChain");
+    return runCall<std::vector<OptionChain>>(client_, [&] { return optionChainCall(symbol, expiration, greeks); }, "getOptionChain");
+}
+
+Result<OptionChainColumns> MarketService::getOptionChainColumns(const std::string& symbol, const std::string& expiration, bool greeks) {
+    return runCall<OptionChainColumns>(client_, [&] { return optionChainColumnsCall(symbol, expiration, greeks); }, "getOptionChainColumns");
 }
 
 Result<std::vector<double>> MarketService::getOptionStrikes(const std::string& symbol, const std::string& expiration, bool includeAllRoots) {
-    return tryExecute<std::vector<double>>([&]() -> std::vector<double> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        if (expiration.empty()) {
-            throw ValidationError("Expiration date cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbol"] = symbol;
-        params["expiration"] = expiration;
-        params["includeAllRoots"] = includeAllRoots ? "true" : "false";
-        
-        auto response = client_.get("/markets/options/strikes", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get option strikes: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<double>>(response, json::parseStrikes);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse option strikes response");
-        }
-        
-        return *parsed;
-    }, "getOptionStrikes");
+    return runCall<std::vector<double>>(client_, [&] { return optionStrikesCall(symbol, expiration, includeAllRoots); }, "getOptionStrikes");
 }
 
 Result<std::vector<Expiration>> MarketService::getOptionExpirations(const std::string& symbol, bool includeAllRoots, bool strikes, bool contractSize, bool expirationType) {
-    return tryExecute<std::vector<Expiration>>([&]() -> std::vector<Expiration> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbol"] = symbol;
-        params["includeAllRoots"] = includeAllRoots ? "true" : "false";
-        params["strikes"] = strikes ? "true" : "false";
-        params["contractSize"] = contractSize ? "true" : "false";
-        params["expirationType"] = expirationType ? "true" : "false";
-        
-        auto response = client_.get("/markets/options/expirations", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get option expirations: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<Expiration>>(response, json::parseExpirations);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse option expirations response");
-        }
-        
-        return *parsed;
+    return runCall<std::vector<Expiration>>(client_, [&] {
+        return optionExpirationsCall(symbol, includeAllRoots, strikes, contractSize, expirationType);
     }, "getOptionExpirations");
 }
+
 Result<std::vector<OptionSymbol>> MarketService::lookupOptionSymbols(const std::string& underlying) {
-    return tryExecute<std::vector<OptionSymbol>>([&]() -> std::vector<OptionSymbol> {
-        if (underlying.empty()) {
-            throw ValidationError("Underlying symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["underlying"] = underlying;
-        
-        auto response = client_.get("/markets/options/lookup", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to lookup option symbols: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<OptionSymbol>>(response, json::parseOptionSymbols);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse option symbols response");
-        }
-        
-        return *parsed;
-    }, "lookupOptionSymbols");
+    return runCall<std::vector<OptionSymbol>>(client_, [&] { return optionSymbolsCall(underlying); }, "lookupOptionSymbols");
 }
 
 Result<std::vector<HistoricalData>> MarketService::getHistoricalData(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
-    return tryExecute<std::vector<HistoricalData>>([&]() -> std::vector<HistoricalData> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbol"] = symbol;
-        params["interval"] = interval;
-        params["session_filter"] = sessionFilter;
-        
-        if (!start.empty()) {
-            params["start"] = start;
-        }
-        if (!end.empty()) {
-            params["end"] = end;
-        }
-        
-        auto response = client_.get("/markets/history", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get historical data: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<HistoricalData>>(response, json::parseHistoricalDataList);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse historical data response");
-        }
-        
-        return *parsed;
+    return runCall<std::vector<HistoricalData>>(client_, [&] {
+        return historicalDataCall(symbol, interval, start, end, sessionFilter);
     }, "getHistoricalData");
 }
 
 Result<std::vector<TimeSalesData>> MarketService::getTimeSales(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
-    return tryExecute<std::vector<TimeSalesData>>([&]() -> std::vector<TimeSalesData> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbol"] = symbol;
-        params["interval"] = interval;
-        params["session_filter"] = sessionFilter;
-        
-        if (!start.empty()) {
-            params["start"] = start;
-        }
-        if (!end.empty()) {
-            params["end"] = end;
-        }
-        
-        auto response = client_.get("/markets/timesales", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get time sales data: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<TimeSalesData>>(response, json::parseTimeSalesList);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse time sales response");
-        }
-        
-        return *parsed;
+    return runCall<std::vector<TimeSalesData>>(client_, [&] {
+        return timeSalesCall(symbol, interval, start, end, sessionFilter);
     }, "getTimeSales");
 }
 
 Result<std::vector<Security>> MarketService::getETBList() {
-    return tryExecute<std::vector<Security>>([&]() -> std::vector<Security> {
-        auto response = client_.get("/markets/etb");
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get ETB list: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<Security>>(response, json::parseSecurities);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse ETB list response");
-        }
-        
-        return *parsed;
-    }, "getETBList");
+    return runCall<std::vector<Security>>(client_, [] { return etbListCall(); }, "getETBList");
+}
+
+Result<size_t> MarketService::streamHistoricalData(const std::string& symbol, std::function<void(const HistoricalData&)> onRow, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
+    return runStream<HistoricalData>(client_, [&] {
+        return historicalDataCall(symbol, interval, start, end, sessionFilter);
+    }, {"history", "day"}, json::parseHistoricalDataRow, onRow, "streamHistoricalData");
+}
+
+Result<size_t> MarketService::streamTimeSales(const std::string& symbol, std::function<void(const TimeSalesData&)> onRow, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
+    return runStream<TimeSalesData>(client_, [&] {
+        return timeSalesCall(symbol, interval, start, end, sessionFilter);
+    }, {"series", "data"}, json::parseTimeSalesRow, onRow, "streamTimeSales");
+}
+
+Result<size_t> MarketService::streamETBList(std::function<void(const Security&)> onRow) {
+    return runStream<Security>(client_, [] { return etbListCall(); },
+        {"securities", "security"}, json::parseSecurityRow, onRow, "streamETBList");
 }
 
 Result<MarketClock> MarketService::getClock(bool delayed) {
-    return tryExecute<MarketClock>([&]() -> MarketClock {
-        QueryParams params;
-        if (delayed) {
-            params["delayed"] = "true";
-        }
-        
-        auto response = client_.get("/markets/clock", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get market clock: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<MarketClock>(response, json::parseMarketClock);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse market clock response");
-        }
-        
-        return *parsed;
-    }, "getClock");
+    return runCall<MarketClock>(client_, [&] { return clockCall(delayed); }, "getClock");
 }
 
 Result<MarketCalendar> MarketService::getCalendar(const std::string& month, const std::string& year) {
-    return tryExecute<MarketCalendar>([&]() -> MarketCalendar {
-        QueryParams params;
-        if (!month.empty()) {
-            params["month"] = month;
-        }
-        if (!year.empty()) {
-            params["year"] = year;
-        }
-        
-        auto response = client_.get("/markets/calendar", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get market calendar: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<MarketCalendar>(response, json::parseMarketCalendar);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse market calendar response");
-        }
-        
-        return *parsed;
-    }, "getCalendar");
+    return runCall<MarketCalendar>(client_, [&] { return calendarCall(month, year); }, "getCalendar");
 }
 
 Result<std::vector<Security>> MarketService::searchSymbols(const std::string& query, bool indexes) {
-    return tryExecute<std::vector<Security>>([&]() -> std::vector<Security> {
-        if (query.empty()) {
-            throw ValidationError("Search query cannot be empty");
-        }
-        
-        QueryParams params;
-        params["q"] = query;
-        params["indexes"] = indexes ? "true" : "false";
-        
-        auto response = client_.get("/markets/search", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to search symbols: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<Security>>(response, json::parseSecurities);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse symbol search response");
-        }
-        
-        return *parsed;
-    }, "searchSymbols");
+    return runCall<std::vector<Security>>(client_, [&] { return searchSymbolsCall(query, indexes); }, "searchSymbols");
 }
 
 Result<std::vector<Security>> MarketService::lookupSymbols(const std::string& query, const std::string& exchanges, const std::string& types) {
-    return tryExecute<std::vector<Security>>([&]() -> std::vector<Security> {
-        if (query.empty()) {
-            throw ValidationError("Search query cannot be empty");
-        }
-        
-        QueryParams params;
-        params["q"] = query;
-        
-        if (!exchanges.empty()) {
-            params["exchanges"] = exchanges;
-        }
-        if (!types.empty()) {
-            params["types"] = types;
-        }
-        
-        auto response = client_.get("/markets/lookup", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to lookup symbols: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<Security>>(response, json::parseSecurities);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse symbol lookup response");
-        }
-        
-        return *parsed;
-    }, "lookupSymbols");
+    return runCall<std::vector<Security>>(client_, [&] { return lookupSymbolsCall(query, exchanges, types); }, "lookupSymbols");
 }
 
 Result<CompanyFundamentals> MarketService::getCompanyInfo(const std::string& symbol) {
-    return tryExecute<CompanyFundamentals>([&]() -> CompanyFundamentals {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbols"] = symbol;
-        
-        auto response = client_.get("/beta/markets/fundamentals/company", params);
-        
-        if (!response.success()) {
-            if (response.status == 302) {
-                throw ::tradier::ApiError(response.status, "Company fundamentals endpoint redirected - feature unavailable");
-            }
-            throw ::tradier::ApiError(response.status, "Failed to get company info: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<CompanyFundamentals>(response, json::parseCompanyFundamentals);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse company fundamentals response");
-        }
-        
-        return *parsed;
-    }, "getCompanyInfo");
+    return runCall<CompanyFundamentals>(client_, [&] { return companyInfoCall(symbol); }, "getCompanyInfo");
 }
 
 Result<std::vector<CorporateCalendarEvent>> MarketService::getCorporateCalendar(const std::string& symbol) {
-    return tryExecute<std::vector<CorporateCalendarEvent>>([&]() -> std::vector<CorporateCalendarEvent> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbols"] = symbol;
-        
-        auto response = client_.get("/beta/markets/fundamentals/calendars", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get corporate calendar: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<CorporateCalendarEvent>>(response, json::parseCorporateCalendar);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse corporate calendar response");
-        }
-        
-        return *parsed;
-    }, "getCorporateCalendar");
+    return runCall<std::vector<CorporateCalendarEvent>>(client_, [&] { return corporateCalendarCall(symbol); }, "getCorporateCalendar");
 }
 
 Result<std::vector<Dividend>> MarketService::getDividends(const std::string& symbol) {
-    return tryExecute<std::vector<Dividend>>([&]() -> std::vector<Dividend> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbols"] = symbol;
-        
-        auto response = client_.get("/beta/markets/fundamentals/dividends", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get dividends: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<Dividend>>(response, json::parseDividends);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse dividends response");
-        }
-        
-        return *parsed;
-    }, "getDividends");
+    return runCall<std::vector<Dividend>>(client_, [&] { return dividendsCall(symbol); }, "getDividends");
 }
 
 Result<CorporateActions> MarketService::getCorporateActions(const std::string& symbol) {
-    return tryExecute<CorporateActions>([&]() -> CorporateActions {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbols"] = symbol;
-        
-        auto response = client_.get("/beta/markets/fundamentals/corporate_actions", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get corporate actions: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<CorporateActions>(response, json::parseCorporateActions);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse corporate actions response");
-        }
-        
-        return *parsed;
-    }, "getCorporateActions");
+    return runCall<CorporateActions>(client_, [&] { return corporateActionsCall(symbol); }, "getCorporateActions");
 }
 
 Result<std::vector<FinancialRatios>> MarketService::getFinancialRatios(const std::string& symbol) {
-    return tryExecute<std::vector<FinancialRatios>>([&]() -> std::vector<FinancialRatios> {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbols"] = symbol;
-        
-        auto response = client_.get("/beta/markets/fundamentals/ratios", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get financial ratios: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<std::vector<FinancialRatios>>(response, json::parseFinancialRatios);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse financial ratios response");
-        }
-        
-        return *parsed;
-    }, "getFinancialRatios");
+    return runCall<std::vector<FinancialRatios>>(client_, [&] { return financialRatiosCall(symbol); }, "getFinancialRatios");
 }
 
 Result<FinancialStatement> MarketService::getFinancialStatements(const std::string& symbol) {
-    return tryExecute<FinancialStatement>([&]() -> FinancialStatement {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbols"] = symbol;
-        
-        auto response = client_.get("/beta/markets/fundamentals/financials", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get financial statements: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<FinancialStatement>(response, json::parseFinancialStatements);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse financial statements response");
-        }
-        
-        return *parsed;
-    }, "getFinancialStatements");
+    return runCall<FinancialStatement>(client_, [&] { return financialStatementsCall(symbol); }, "getFinancialStatements");
 }
 
 Result<PriceStatistics> MarketService::getPriceStatistics(const std::string& symbol) {
-    return tryExecute<PriceStatistics>([&]() -> PriceStatistics {
-        if (symbol.empty()) {
-            throw ValidationError("Symbol cannot be empty");
-        }
-        
-        QueryParams params;
-        params["symbols"] = symbol;
-        
-        auto response = client_.get("/beta/markets/fundamentals/statistics", params);
-        
-        if (!response.success()) {
-            throw ::tradier::ApiError(response.status, "Failed to get price statistics: " + response.body);
-        }
-        
-        auto parsed = json::parseResponse<PriceStatistics>(response, json::parsePriceStatistics);
-        if (!parsed) {
-            throw std::runtime_error("Failed to parse price statistics response");
-        }
-        
-        return *parsed;
-    }, "getPriceStatistics");
+    return runCall<PriceStatistics>(client_, [&] { return priceStatisticsCall(symbol); }, "getPriceStatistics");
 }
 
 
 SimpleAsyncResult<std::vector<Quote>> MarketService::getQuotesAsync(const std::vector<std::string>& symbols, bool greeks) {
-    return makeSimpleAsync<std::vector<Quote>>([this, symbols, greeks]() {
-        return getQuotes(symbols, greeks);
-    });
+    return runCallFuture<std::vector<Quote>>(client_, [&] { return quotesCall(symbols, greeks, false); }, "getQuotes");
 }
 
 SimpleAsyncResult<std::vector<Quote>> MarketService::getQuotesPostAsync(const std::vector<std::string>& symbols, bool greeks) {
-    return makeSimpleAsync<std::vector<Quote>>([this, symbols, greeks]() {
-        return getQuotesPost(symbols, greeks);
-    });
+    return runCallFuture<std::vector<Quote>>(client_, [&] { return quotesCall(symbols, greeks, true); }, "getQuotesPost");
 }
 
 SimpleAsyncResult<Quote> MarketService::getQuoteAsync(const std::string& symbol, bool greeks) {
-    return makeSimpleAsync<Quote>([this, symbol, greeks]() {
-        return getQuote(symbol, greeks);
-    });
+    return runCallFuture<Quote>(client_, [&] { return quoteCall(symbol, greeks); }, "getQuote");
 }
 
 SimpleAsyncResult<std::vector<OptionChain>> MarketService::getOptionChainAsync(const std::string& symbol, const std::string& expiration, bool greeks) {
-    return makeSimpleAsync<std::vector<OptionChain>>([this, symbol, expiration, greeks]() {
-        return getOptionChain(symbol, expiration, greeks);
-    });
+    return runCallFuture<std::vector<OptionChain>>(client_, [&] { return optionChainCall(symbol, expiration, greeks); }, "getOptionChain");
+}
+
+SimpleAsyncResult<OptionChainColumns> MarketService::getOptionChainColumnsAsync(const std::string& symbol, const std::string& expiration, bool greeks) {
+    return runCallFuture<OptionChainColumns>(client_, [&] { return optionChainColumnsCall(symbol, expiration, greeks); }, "getOptionChainColumns");
 }
 
 SimpleAsyncResult<std::vector<double>> MarketService::getOptionStrikesAsync(const std::string& symbol, const std::string& expiration, bool includeAllRoots) {
-    return makeSimpleAsync<std::vector<double>>([this, symbol, expiration, includeAllRoots]() {
-        return getOptionStrikes(symbol, expiration, includeAllRoots);
-    });
+    return runCallFuture<std::vector<double>>(client_, [&] { return optionStrikesCall(symbol, expiration, includeAllRoots); }, "getOptionStrikes");
 }
 
 SimpleAsyncResult<std::vector<Expiration>> MarketService::getOptionExpirationsAsync(const std::string& symbol, bool includeAllRoots, bool strikes, bool contractSize, bool expirationType) {
-    return makeSimpleAsync<std::vector<Expiration>>([this, symbol, includeAllRoots, strikes, contractSize, expirationType]() {
-        return getOptionExpirations(symbol, includeAllRoots, strikes, contractSize, expirationType);
-    });
+    return runCallFuture<std::vector<Expiration>>(client_, [&] {
+        return optionExpirationsCall(symbol, includeAllRoots, strikes, contractSize, expirationType);
+    }, "getOptionExpirations");
 }
 
 SimpleAsyncResult<std::vector<OptionSymbol>> MarketService::lookupOptionSymbolsAsync(const std::string& underlying) {
-    return makeSimpleAsync<std::vector<OptionSymbol>>([this, underlying]() {
-        return lookupOptionSymbols(underlying);
-    });
+    return runCallFuture<std::vector<OptionSymbol>>(client_, [&] { return optionSymbolsCall(underlying); }, "lookupOptionSymbols");
 }
 
-AsyncResult<std::vector<HistoricalData>> MarketService::getHistoricalDataAsync(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
-    return makeAsync<std::vector<HistoricalData>>([this, symbol, interval, start, end, sessionFilter]() {
-        return getHistoricalData(symbol, interval, start, end, sessionFilter);
-    });
+SimpleAsyncResult<std::vector<HistoricalData>> MarketService::getHistoricalDataAsync(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
+    return runCallFuture<std::vector<HistoricalData>>(client_, [&] {
+        return historicalDataCall(symbol, interval, start, end, sessionFilter);
+    }, "getHistoricalData");
 }
 
-AsyncResult<std::vector<TimeSalesData>> MarketService::getTimeSalesAsync(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
-    return makeAsync<std::vector<TimeSalesData>>([this, symbol, interval, start, end, sessionFilter]() {
-        return getTimeSales(symbol, interval, start, end, sessionFilter);
-    });
+SimpleAsyncResult<std::vector<TimeSalesData>> MarketService::getTimeSalesAsync(const std::string& symbol, const std::string& interval, const std::string& start, const std::string& end, const std::string& sessionFilter) {
+    return runCallFuture<std::vector<TimeSalesData>>(client_, [&] {
+        return timeSalesCall(symbol, interval, start, end, sessionFilter);
+    }, "getTimeSales");
 }
 
-AsyncResult<std::vector<Security>> MarketService::getETBListAsync() {
-    return makeAsync<std::vector<Security>>([this]() {
-        return getETBList();
-    });
+SimpleAsyncResult<std::vector<Security>> MarketService::getETBListAsync() {
+    return runCallFuture<std::vector<Security>>(client_, [] { return etbListCall(); }, "getETBList");
 }
 
-AsyncResult<MarketClock> MarketService::getClockAsync(bool delayed) {
-    return makeAsync<MarketClock>([this, delayed]() {
-        return getClock(delayed);
-    });
+SimpleAsyncResult<MarketClock> MarketService::getClockAsync(bool delayed) {
+    return runCallFuture<MarketClock>(client_, [&] { return clockCall(delayed); }, "getClock");
 }
 
-AsyncResult<MarketCalendar> MarketService::getCalendarAsync(const std::string& month, const std::string& year) {
-    return makeAsync<MarketCalendar>([this, month, year]() {
-        return getCalendar(month, year);
-    });
+SimpleAsyncResult<MarketCalendar> MarketService::getCalendarAsync(const std::string& month, const std::string& year) {
+    return runCallFuture<MarketCalendar>(client_, [&] { return calendarCall(month, year); }, "getCalendar");
 }
 
-AsyncResult<std::vector<Security>> MarketService::searchSymbolsAsync(const std::string& query, bool indexes) {
-    return makeAsync<std::vector<Security>>([this, query, indexes]() {
-        return searchSymbols(query, indexes);
-    });
+SimpleAsyncResult<std::vector<Security>> MarketService::searchSymbolsAsync(const std::string& query, bool indexes) {
+    return runCallFuture<std::vector<Security>>(client_, [&] { return searchSymbolsCall(query, indexes); }, "searchSymbols");
 }
 
-AsyncResult<std::vector<Security>> MarketService::lookupSymbolsAsync(const std::string& query, const std::string& exchanges, const std::string& types) {
-    return makeAsync<std::vector<Security>>([this, query, exchanges, types]() {
-        return lookupSymbols(query, exchanges, types);
-    });
+SimpleAsyncResult<std::vector<Security>> MarketService::lookupSymbolsAsync(const std::string& query, const std::string& exchanges, const std::string& types) {
+    return runCallFuture<std::vector<Security>>(client_, [&] { return lookupSymbolsCall(query, exchanges, types); }, "lookupSymbols");
 }
 
-AsyncResult<CompanyFundamentals> MarketService::getCompanyInfoAsync(const std::string& symbol) {
-    return makeAsync<CompanyFundamentals>([this, symbol]() {
-        return getCompanyInfo(symbol);
-    });
+SimpleAsyncResult<CompanyFundamentals> MarketService::getCompanyInfoAsync(const std::string& symbol) {
+    return runCallFuture<CompanyFundamentals>(client_, [&] { return companyInfoCall(symbol); }, "getCompanyInfo");
 }
 
-AsyncResult<std::vector<CorporateCalendarEvent>> MarketService::getCorporateCalendarAsync(const std::string& symbol) {
-    return makeAsync<std::vector<CorporateCalendarEvent>>([this, symbol]() {
-        return getCorporateCalendar(symbol);
-    });
+SimpleAsyncResult<std::vector<CorporateCalendarEvent>> MarketService::getCorporateCalendarAsync(const std::string& symbol) {
+    return runCallFuture<std::vector<CorporateCalendarEvent>>(client_, [&] { return corporateCalendarCall(symbol); }, "getCorporateCalendar");
 }
 
-AsyncResult<std::vector<Dividend>> MarketService::getDividendsAsync(const std::string& symbol) {
-    return makeAsync<std::vector<Dividend>>([this, symbol]() {
-        return getDividends(symbol);
-    });
+SimpleAsyncResult<std::vector<Dividend>> MarketService::getDividendsAsync(const std::string& symbol) {
+    return runCallFuture<std::vector<Dividend>>(client_, [&] { return dividendsCall(symbol); }, "getDividends");
 }
 
-AsyncResult<CorporateActions> MarketService::getCorporateActionsAsync(const std::string& symbol) {
-    return makeAsync<CorporateActions>([this, symbol]() {
-        return getCorporateActions(symbol);
-    });
+SimpleAsyncResult<CorporateActions> MarketService::getCorporateActionsAsync(const std::string& symbol) {
+    return runCallFuture<CorporateActions>(client_, [&] { return corporateActionsCall(symbol); }, "getCorporateActions");
 }
 
-AsyncResult<std::vector<FinancialRatios>> MarketService::getFinancialRatiosAsync(const std::string& symbol) {
-    return makeAsync<std::vector<FinancialRatios>>([this, symbol]() {
-        return getFinancialRatios(symbol);
-    });
+SimpleAsyncResult<std::vector<FinancialRatios>> MarketService::getFinancialRatiosAsync(const std::string& symbol) {
+    return runCallFuture<std::vector<FinancialRatios>>(client_, [&] { return financialRatiosCall(symbol); }, "getFinancialRatios");
 }
 
-AsyncResult<FinancialStatement> MarketService::getFinancialStatementsAsync(const std::string& symbol) {
-    return makeAsync<FinancialStatement>([this, symbol]() {
-        return getFinancialStatements(symbol);
-    });
+SimpleAsyncResult<FinancialStatement> MarketService::getFinancialStatementsAsync(const std::string& symbol) {
+    return runCallFuture<FinancialStatement>(client_, [&] { return financialStatementsCall(symbol); }, "getFinancialStatements");
 }
 
-AsyncResult<PriceStatistics> MarketService::getPriceStatisticsAsync(const std::string& symbol) {
-    return makeAsync<PriceStatistics>([this, symbol]() {
-        return getPriceStatistics(symbol);
-    });
+SimpleAsyncResult<PriceStatistics> MarketService::getPriceStatisticsAsync(const std::string& symbol) {
+    return runCallFuture<PriceStatistics>(client_, [&] { return priceStatisticsCall(symbol); }, "getPriceStatistics");
 }
 
 
 void MarketService::getQuotesAsync(const std::vector<std::string>& symbols, SimpleAsyncCallback<std::vector<Quote>> callback, bool greeks) {
-    executeSimpleAsync<std::vector<Quote>>([this, symbols, greeks]() {
-        return getQuotes(symbols, greeks);
-    }, std::move(callback));
+    runCallAsync<std::vector<Quote>>(client_, [&] { return quotesCall(symbols, greeks, false); }, "getQuotes",
+        [callback = std::move(callback)](Result<std::vector<Quote>> result) { callback(result); });
 }
 
 void MarketService::getQuoteAsync(const std::string& symbol, SimpleAsyncCallback<Quote> callback, bool greeks) {
-    executeSimpleAsync<Quote>([this, symbol, greeks]() {
-        return getQuote(symbol, greeks);
-    }, std::move(callback));
+    runCallAsync<Quote>(client_, [&] { return quoteCall(symbol, greeks); }, "getQuote",
+        [callback = std::move(callback)](Result<Quote> result) { callback(result); });
 }
 
-}
\ No newline at end of file
+}
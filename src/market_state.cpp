@@ -0,0 +1,128 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include "tradier/market_state.hpp"
+
+#include <algorithm>
+
+namespace tradier {
+
+MarketStateCache::MarketStateCache(std::shared_ptr<const SymbolTable> symbols, size_t capacity)
+    : symbols_(std::move(symbols)),
+      blockCount_((std::max<size_t>(capacity, 1) + BLOCK_ROWS - 1) / BLOCK_ROWS) {
+    blocks_ = std::make_unique<std::atomic<Row*>[]>(blockCount_);
+    for (size_t i = 0; i < blockCount_; ++i) {
+        blocks_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+MarketStateCache::~MarketStateCache() {
+    for (size_t i = 0; i < blockCount_; ++i) {
+        delete[] blocks_[i].load(std::memory_order_relaxed);
+    }
+}
+
+MarketStateCache::Row* MarketStateCache::writableRow(SymbolId id) {
+    size_t block = id / BLOCK_ROWS;
+    if (block >= blockCount_) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    
+    Row* rows = blocks_[block].load(std::memory_order_acquire);
+    if (!rows) {
+        // Writers of different shards may race to allocate the same block
+        auto* fresh = new Row[BLOCK_ROWS];
+        if (blocks_[block].compare_exchange_strong(rows, fresh, std::memory_order_acq_rel)) {
+            rows = fresh;
+        } else {
+            delete[] fresh;
+        }
+    }
+    return &rows[id % BLOCK_ROWS];
+}
+
+const MarketStateCache::Row* MarketStateCache::findRow(SymbolId id) const {
+    size_t block = id / BLOCK_ROWS;
+    if (block >= blockCount_) {
+        return nullptr;
+    }
+    
+    const Row* rows = blocks_[block].load(std::memory_order_acquire);
+    return rows ? &rows[id % BLOCK_ROWS] : nullptr;
+}
+
+void MarketStateCache::apply(const CompactQuoteEvent& event) {
+    Row* row = writableRow(event.symbol);
+    if (!row) {
+        return;
+    }
+    
+    row->state.update([&](MarketState& state) {
+        state.bid = event.bid;
+        state.ask = event.ask;
+        state.bidTimeMs = event.bidTimeMs;
+        state.askTimeMs = event.askTimeMs;
+        state.bidSize = event.bidSize;
+        state.askSize = event.askSize;
+        state.bidExchange = event.bidExchange;
+        state.askExchange = event.askExchange;
+        state.quoteUpdates++;
+    });
+}
+
+void MarketStateCache::apply(const CompactTradeEvent& event) {
+    Row* row = writableRow(event.symbol);
+    if (!row) {
+        return;
+    }
+    
+    row->state.update([&](MarketState& state) {
+        state.lastPrice = event.price;
+        state.lastTimeMs = event.timestampMs;
+        state.cumulativeVolume = event.cvol;
+        state.lastSize = event.size;
+        state.lastExchange = event.exchange;
+        state.tradeUpdates++;
+    });
+}
+
+bool MarketStateCache::snapshot(SymbolId id, MarketState& out) const {
+    const Row* row = findRow(id);
+    if (!row || row->state.version() == 0) {
+        return false;
+    }
+    out = row->state.load();
+    return true;
+}
+
+std::optional<MarketState> MarketStateCache::snapshot(std::string_view symbol) const {
+    auto id = symbols_->find(symbol);
+    MarketState state;
+    if (!id || !snapshot(*id, state)) {
+        return std::nullopt;
+    }
+    return state;
+}
+
+size_t MarketStateCache::capacity() const {
+    return blockCount_ * BLOCK_ROWS;
+}
+
+uint64_t MarketStateCache::rejected() const {
+    return rejected_.load(std::memory_order_relaxed);
+}
+
+const SymbolTable& MarketStateCache::symbols() const {
+    return *symbols_;
+}
+
+}
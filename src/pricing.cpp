@@ -0,0 +1,140 @@
+/*
+ * libtradier - Tradier API C++ Library v0.1.0
+ *
+ * Author: Benjamin Cance (kc8bws@kc8bws.com)
+ * Date: 2025-05-22
+ *
+ * This software is provided free of charge under the MIT License.
+ * By using it, you agree to absolve the author of all liability.
+ * See LICENSE file for full terms and conditions.
+ */
+
+#include "tradier/pricing.hpp"
+#include "tradier/streaming.hpp"
+#include "tradier/simd/chain_analytics.hpp"
+
+#include <cmath>
+
+namespace tradier {
+
+namespace {
+
+OptionChainColumns toColumns(const std::vector<OptionChain>& chain) {
+    OptionChainColumns columns;
+    columns.reserve(chain.size());
+    columns.symbolOffsets.push_back(0);
+    
+    for (const auto& option : chain) {
+        const Greeks greeks = option.greeks.value_or(Greeks{});
+        uint8_t validity = 0;
+        if (option.last) validity |= OptionChainColumns::HAS_LAST;
+        if (option.change) validity |= OptionChainColumns::HAS_CHANGE;
+        if (option.greeks) validity |= OptionChainColumns::HAS_GREEKS;
+        
+        columns.strike.push_back(option.strike);
+        columns.bid.push_back(option.bid);
+        columns.ask.push_back(option.ask);
+        columns.last.push_back(option.last.value_or(0.0));
+        columns.change.push_back(option.change.value_or(0.0));
+        columns.volume.push_back(option.volume);
+        columns.openInterest.push_back(option.openInterest);
+        columns.bidSize.push_back(option.bidSize);
+        columns.askSize.push_back(option.askSize);
+        columns.contractSize.push_back(option.contractSize);
+        columns.right.push_back(option.optionType == "call" ? OptionRight::CALL
+                              : option.optionType == "put" ? OptionRight::PUT
+                              : OptionRight::UNKNOWN);
+        columns.delta.push_back(greeks.delta);
+        columns.gamma.push_back(greeks.gamma);
+        columns.theta.push_back(greeks.theta);
+        columns.vega.push_back(greeks.vega);
+        columns.rho.push_back(greeks.rho);
+        columns.bidIv.push_back(greeks.bidIv);
+        columns.midIv.push_back(greeks.midIv);
+        columns.askIv.push_back(greeks.askIv);
+        columns.smvVol.push_back(greeks.smvVol);
+        columns.validity.push_back(validity);
+        columns.symbolPool += option.symbol;
+        columns.symbolOffsets.push_back(static_cast<uint32_t>(columns.symbolPool.size()));
+        
+        if (columns.underlying.empty()) columns.underlying = option.underlying;
+        if (columns.expirationDate.empty()) columns.expirationDate = option.expirationDate;
+    }
+    return columns;
+}
+
+}
+
+OptionChainPricer::OptionChainPricer(OptionChainColumns chain, double expiryYears, PricingParameters parameters)
+    : chain_(std::move(chain)), parameters_(parameters) {
+    indexRows();
+    setExpiryYears(expiryYears);
+}
+
+OptionChainPricer::OptionChainPricer(const std::vector<OptionChain>& chain, double expiryYears, PricingParameters parameters)
+    : OptionChainPricer(toColumns(chain), expiryYears, parameters) {}
+
+void OptionChainPricer::indexRows() {
+    rows_.reserve(chain_.size());
+    for (size_t row = 0; row < chain_.size(); ++row) {
+        rows_.emplace(std::string(chain_.symbol(row)), row);
+    }
+    mid_.resize(chain_.size());
+}
+
+void OptionChainPricer::setExpiryYears(double years) {
+    expiry_.assign(chain_.size(), years);
+}
+
+bool OptionChainPricer::applyQuote(const QuoteEvent& quote) {
+    if (quote.symbol == chain_.underlying) {
+        if (quote.bid > 0.0 && quote.ask > 0.0) {
+            underlyingPrice_ = (quote.bid + quote.ask) * 0.5;
+        }
+        return true;
+    }
+    
+    auto it = rows_.find(quote.symbol);
+    if (it == rows_.end()) {
+        return false;
+    }
+    chain_.bid[it->second] = quote.bid;
+    chain_.ask[it->second] = quote.ask;
+    return true;
+}
+
+size_t OptionChainPricer::refresh() {
+    size_t count = chain_.size();
+    if (count == 0 || !(underlyingPrice_ > 0.0)) {
+        return 0;
+    }
+    
+    simd::pricing::market market;
+    market.kind = parameters_.model;
+    market.underlying = underlyingPrice_;
+    market.rate = parameters_.rate;
+    market.dividend_yield = parameters_.dividendYield;
+    simd::pricing::contracts rows{chain_.strike.data(), expiry_.data(), chain_.right.data(), count};
+    
+    simd::chain::mid_price(chain_, mid_.data());
+    size_t solved = simd::pricing::implied_volatility(market, rows, mid_.data(), chain_.midIv.data());
+    
+    simd::pricing::outputs out;
+    out.delta = chain_.delta.data();
+    out.gamma = chain_.gamma.data();
+    out.theta = chain_.theta.data();
+    out.vega = chain_.vega.data();
+    out.rho = chain_.rho.data();
+    simd::pricing::price(market, rows, chain_.midIv.data(), out);
+    
+    for (size_t row = 0; row < count; ++row) {
+        if (std::isnan(chain_.midIv[row])) {
+            chain_.validity[row] &= static_cast<uint8_t>(~OptionChainColumns::HAS_GREEKS);
+        } else {
+            chain_.validity[row] |= OptionChainColumns::HAS_GREEKS;
+        }
+    }
+    return solved;
+}
+
+}
@@ -0,0 +1,508 @@
+/*
+ * SIMD Black-Scholes / Black-76 Pricing Implementation
+ */
+
+#include "tradier/simd/black_scholes.hpp"
+#include "tradier/market.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE || LIBTRADIER_SIMD_AVX512_AVAILABLE
+#include <immintrin.h>
+
+// The width-generic lane templates below are default-target definitions that
+// only ever exist inlined into the variants, so GCC's notes about passing
+// vectors by value without AVX enabled do not apply (they are reported at the
+// end of the file, where templates are instantiated).
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace tradier {
+namespace simd {
+namespace pricing {
+
+namespace {
+
+constexpr double NOT_A_NUMBER = std::numeric_limits<double>::quiet_NaN();
+constexpr double INV_SQRT_2PI = 0.39894228040143267794;
+constexpr double DAYS_PER_YEAR = 365.0;
+
+// Per-row terms shared by pricing and the solver
+struct row_terms {
+    double forward;
+    double carry;       // forward / underlying
+    double discount;
+    double sign;        // +1 call, -1 put
+};
+
+row_terms make_terms(const market& mkt, double expiry, OptionRight right) {
+    row_terms terms;
+    terms.discount = std::exp(-mkt.rate * expiry);
+    terms.carry = mkt.kind == model::black76 ? 1.0 : std::exp((mkt.rate - mkt.dividend_yield) * expiry);
+    terms.forward = mkt.underlying * terms.carry;
+    terms.sign = right == OptionRight::PUT ? -1.0 : 1.0;
+    return terms;
+}
+
+double normal_cdf(double x) {
+    return 0.5 * std::erfc(-x * 0.70710678118654752440);
+}
+
+struct black_values {
+    double price;
+    double nd1;     // N(sign * d1)
+    double nd2;     // N(sign * d2)
+    double pdf;     // n(d1)
+};
+
+black_values black(const row_terms& terms, double strike, double sqrt_expiry, double volatility) {
+    double deviation = volatility * sqrt_expiry;
+    double d1 = (std::log(terms.forward / strike) + 0.5 * deviation * deviation) / deviation;
+    double d2 = d1 - deviation;
+
+    black_values values;
+    values.nd1 = normal_cdf(terms.sign * d1);
+    values.nd2 = normal_cdf(terms.sign * d2);
+    values.pdf = INV_SQRT_2PI * std::exp(-0.5 * d1 * d1);
+    values.price = terms.discount * terms.sign * (terms.forward * values.nd1 - strike * values.nd2);
+    return values;
+}
+
+void store(double* column, size_t row, double value) {
+    if (column) column[row] = value;
+}
+
+void price_rows(const market& mkt, const contracts& rows, const double* volatility, const outputs& out,
+                size_t begin, size_t end) {
+    bool spot = mkt.kind == model::black_scholes;
+    double carry_rate = spot ? mkt.dividend_yield : mkt.rate;
+
+    for (size_t i = begin; i < end; ++i) {
+        double expiry = rows.expiry[i];
+        double strike = rows.strike[i];
+        double vol = volatility[i];
+        row_terms terms = make_terms(mkt, expiry, rows.right[i]);
+
+        if (!(expiry > 0.0 && vol > 0.0)) {
+            double moneyness = terms.sign * (terms.forward - strike);
+            store(out.price, i, terms.discount * std::max(moneyness, 0.0));
+            store(out.delta, i, moneyness > 0.0 ? terms.sign * terms.discount * terms.carry : 0.0);
+            store(out.gamma, i, 0.0);
+            store(out.theta, i, 0.0);
+            store(out.vega, i, 0.0);
+            store(out.rho, i, 0.0);
+            continue;
+        }
+
+        double sqrt_expiry = std::sqrt(expiry);
+        black_values values = black(terms, strike, sqrt_expiry, vol);
+        double decay = terms.discount * terms.forward * values.pdf;
+
+        store(out.price, i, values.price);
+        store(out.delta, i, terms.sign * terms.discount * terms.carry * values.nd1);
+        store(out.gamma, i, terms.discount * terms.carry * values.pdf / (mkt.underlying * vol * sqrt_expiry));
+        store(out.vega, i, decay * sqrt_expiry * 0.01);
+        store(out.theta, i, (-decay * vol / (2.0 * sqrt_expiry)
+                             - terms.sign * mkt.rate * strike * terms.discount * values.nd2
+                             + terms.sign * carry_rate * terms.discount * terms.forward * values.nd1) / DAYS_PER_YEAR);
+        store(out.rho, i, (spot ? terms.sign * strike * expiry * terms.discount * values.nd2
+                                : -expiry * values.price) * 0.01);
+    }
+}
+
+size_t solve_rows(const market& mkt, const contracts& rows, const double* price, double* volatility,
+                  const solver_settings& settings, size_t begin, size_t end) {
+    size_t converged = 0;
+    for (size_t i = begin; i < end; ++i) {
+        double expiry = rows.expiry[i];
+        double strike = rows.strike[i];
+        double target = price[i];
+        row_terms terms = make_terms(mkt, expiry, rows.right[i]);
+
+        double lower = terms.discount * std::max(terms.sign * (terms.forward - strike), 0.0);
+        double upper = terms.discount * (terms.sign > 0.0 ? terms.forward : strike);
+        volatility[i] = NOT_A_NUMBER;
+        if (!(expiry > 0.0 && target > lower && target < upper)) {
+            continue;
+        }
+
+        double sqrt_expiry = std::sqrt(expiry);
+        double low = 0.0;
+        double high = settings.max_volatility;
+        // Brenner-Subrahmanyam at-the-money estimate as the starting point
+        double vol = std::min(std::max(2.50662827463100050242 * target / (terms.discount * terms.forward * sqrt_expiry), 0.05),
+                              0.5 * high);
+
+        for (int iteration = 0; iteration < settings.max_iterations; ++iteration) {
+            black_values values = black(terms, strike, sqrt_expiry, vol);
+            double diff = values.price - target;
+            if (std::fabs(diff) < settings.tolerance) {
+                volatility[i] = vol;
+                ++converged;
+                break;
+            }
+            if (diff > 0.0) {
+                high = vol;
+            } else {
+                low = vol;
+            }
+            double vega = terms.discount * terms.forward * values.pdf * sqrt_expiry;
+            double next = vol - diff / vega;
+            vol = next > low && next < high ? next : 0.5 * (low + high);
+        }
+    }
+    return converged;
+}
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE || LIBTRADIER_SIMD_AVX512_AVAILABLE
+
+// Width-generic lane math on GCC/Clang vector types (__m256d, __m512d). All of
+// it is forced inline, so it is compiled with the calling variant's target
+// flags even at -O0; the square root comes from the variant.
+
+template<typename V>
+using mask_of = decltype(V{} < V{});
+
+template<typename V>
+constexpr size_t lane_count = sizeof(V) / sizeof(double);
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE V splat(double value) {
+    return V{} + value;
+}
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE V load(const double* source) {
+    V value;
+    std::memcpy(&value, source, sizeof(V));
+    return value;
+}
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE void store_lanes(double* column, size_t row, V value) {
+    if (column) std::memcpy(column + row, &value, sizeof(V));
+}
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE V load_sign(const OptionRight* right) {
+    V sign;
+    for (size_t lane = 0; lane < lane_count<V>; ++lane) {
+        sign[lane] = right[lane] == OptionRight::PUT ? -1.0 : 1.0;
+    }
+    return sign;
+}
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE V select(mask_of<V> mask, V yes, V no) {
+    return mask ? yes : no;
+}
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE V abs(V x) {
+    return (V)((mask_of<V>)x & 0x7FFFFFFFFFFFFFFFLL);
+}
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE bool any(mask_of<V> mask) {
+    for (size_t lane = 0; lane < lane_count<V>; ++lane) {
+        if (mask[lane]) return true;
+    }
+    return false;
+}
+
+// Cephes exp: x = n ln2 + r, exp(r) as a Pade form, 2^n built in the exponent
+// bits. Inputs are clamped to the normal range.
+template<typename V>
+LIBTRADIER_SIMD_INLINE V exp(V x) {
+    using M = mask_of<V>;
+    const double shifter = 6755399441055744.0;    // 1.5 * 2^52, rounds to integer
+
+    x = select<V>(x < -708.0, splat<V>(-708.0), x);
+    x = select<V>(x > 709.0, splat<V>(709.0), x);
+
+    V t = x * 1.4426950408889634074 + shifter;
+    V n = t - shifter;
+    V r = x - n * 6.93145751953125E-1 - n * 1.42860682030941723212E-6;
+
+    V rr = r * r;
+    V p = r * ((1.26177193074810590878E-4 * rr + 3.02994407707441961300E-2) * rr + 9.99999999999999999910E-1);
+    V q = ((3.00198505138664455042E-6 * rr + 2.52448340349684104192E-3) * rr + 2.27265548208155028766E-1) * rr
+        + 2.00000000000000000009E0;
+    V e = 1.0 + 2.0 * p / (q - p);
+
+    M k = (M)t - 0x4338000000000000LL;
+    V scale = (V)((k + 1023) << 52);
+    return e * scale;
+}
+
+// Cephes log for positive finite x: x = 2^e m with m in [sqrt(1/2), sqrt(2)),
+// log(m) as x - x^2/2 + x^3 P(x)/Q(x)
+template<typename V>
+LIBTRADIER_SIMD_INLINE V log(V x) {
+    using M = mask_of<V>;
+    M bits = (M)x;
+    V m = (V)((bits & 0x000FFFFFFFFFFFFFLL) | 0x3FF0000000000000LL);
+    V e = (V)((bits >> 52) | 0x4330000000000000LL) - (4503599627370496.0 + 1023.0);
+
+    M big = m > 1.41421356237309504880;
+    m = select<V>(big, m * 0.5, m);
+    e = select<V>(big, e + 1.0, e);
+
+    V f = m - 1.0;
+    V z = f * f;
+    V p = ((((1.01875663804580931796E-4 * f + 4.97494994976747001425E-1) * f + 4.70579119878881725854E0) * f
+            + 1.44989225341610930846E1) * f + 1.79368678507819816313E1) * f + 7.70838733755885391666E0;
+    V q = ((((f + 1.12873587189167450590E1) * f + 4.52279145837532221105E1) * f + 8.29875266912776603211E1) * f
+           + 7.11544750618563894466E1) * f + 2.31251620126765340583E1;
+    V y = f * (z * p / q);
+    y = y - e * 2.121944400546905827679E-4;
+    y = y - 0.5 * z;
+    return f + y + e * 0.693359375;
+}
+
+// Standard normal CDF, Hart (1968) double precision rational form as given
+// by West (2005); the tail beyond |x| = 7.07 uses the continued fraction
+template<typename V>
+LIBTRADIER_SIMD_INLINE V normal_cdf(V x) {
+    V ax = abs(x);
+    V e = exp<V>(-0.5 * ax * ax);
+
+    V num = ((((((3.52624965998911E-02 * ax + 0.700383064443688) * ax + 6.37396220353165) * ax + 33.912866078383) * ax
+              + 112.079291497871) * ax + 221.213596169931) * ax + 220.206867912376);
+    V den = (((((((8.83883476483184E-02 * ax + 1.75566716318264) * ax + 16.064177579207) * ax + 86.7807322029461) * ax
+               + 296.564248779674) * ax + 637.333633378831) * ax + 793.826512519948) * ax + 440.413735824752);
+    V central = e * num / den;
+
+    V fraction = ax + 0.65;
+    fraction = ax + 4.0 / fraction;
+    fraction = ax + 3.0 / fraction;
+    fraction = ax + 2.0 / fraction;
+    fraction = ax + 1.0 / fraction;
+    V tail = e / fraction / 2.506628274631;
+
+    V lower = select<V>(ax < 7.07106781186547, central, tail);
+    lower = select<V>(ax > 37.0, splat<V>(0.0), lower);
+    return select<V>(x > 0.0, 1.0 - lower, lower);
+}
+
+template<typename V>
+struct lane_terms {
+    V forward;
+    V carry;
+    V discount;
+    V sign;
+};
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE lane_terms<V> make_lane_terms(const market& mkt, V expiry, const OptionRight* right) {
+    lane_terms<V> terms;
+    terms.discount = exp<V>(-mkt.rate * expiry);
+    terms.carry = mkt.kind == model::black76 ? splat<V>(1.0) : exp<V>((mkt.rate - mkt.dividend_yield) * expiry);
+    terms.forward = mkt.underlying * terms.carry;
+    terms.sign = load_sign<V>(right);
+    return terms;
+}
+
+template<typename V>
+struct lane_values {
+    V price;
+    V nd1;
+    V nd2;
+    V pdf;
+};
+
+template<typename V>
+LIBTRADIER_SIMD_INLINE lane_values<V> black(const lane_terms<V>& terms, V strike, V sqrt_expiry, V volatility) {
+    V deviation = volatility * sqrt_expiry;
+    V d1 = (log<V>(terms.forward / strike) + 0.5 * deviation * deviation) / deviation;
+    V d2 = d1 - deviation;
+
+    lane_values<V> values;
+    values.nd1 = normal_cdf<V>(terms.sign * d1);
+    values.nd2 = normal_cdf<V>(terms.sign * d2);
+    values.pdf = INV_SQRT_2PI * exp<V>(-0.5 * d1 * d1);
+    values.price = terms.discount * terms.sign * (terms.forward * values.nd1 - values.nd2 * strike);
+    return values;
+}
+
+template<typename V, typename Sqrt>
+LIBTRADIER_SIMD_INLINE void price_lanes(const market& mkt, const contracts& rows, const double* volatility,
+                                        const outputs& out, size_t i, Sqrt sqrt_of) {
+    using M = mask_of<V>;
+    bool spot = mkt.kind == model::black_scholes;
+    double carry_rate = spot ? mkt.dividend_yield : mkt.rate;
+
+    V expiry = load<V>(rows.expiry + i);
+    V strike = load<V>(rows.strike + i);
+    V vol = load<V>(volatility + i);
+    lane_terms<V> terms = make_lane_terms<V>(mkt, expiry, rows.right + i);
+
+    // Expired or zero-volatility lanes run on placeholders and are replaced below
+    M live = (expiry > 0.0) & (vol > 0.0);
+    expiry = select<V>(live, expiry, splat<V>(1.0));
+    vol = select<V>(live, vol, splat<V>(1.0));
+
+    V sqrt_expiry = sqrt_of(expiry);
+    lane_values<V> values = black<V>(terms, strike, sqrt_expiry, vol);
+    V decay = terms.discount * terms.forward * values.pdf;
+    V zero = splat<V>(0.0);
+
+    V moneyness = terms.sign * (terms.forward - strike);
+    V intrinsic = terms.discount * select<V>(moneyness > 0.0, moneyness, zero);
+    V expired_delta = select<V>(moneyness > 0.0, terms.sign * terms.discount * terms.carry, zero);
+
+    store_lanes<V>(out.price, i, select<V>(live, values.price, intrinsic));
+    store_lanes<V>(out.delta, i, select<V>(live, terms.sign * terms.discount * terms.carry * values.nd1, expired_delta));
+    if (out.gamma) {
+        store_lanes<V>(out.gamma, i, select<V>(live, terms.discount * terms.carry * values.pdf
+                                                    / (mkt.underlying * vol * sqrt_expiry), zero));
+    }
+    if (out.vega) {
+        store_lanes<V>(out.vega, i, select<V>(live, decay * sqrt_expiry * 0.01, zero));
+    }
+    if (out.theta) {
+        V theta = (-decay * vol / (2.0 * sqrt_expiry)
+                   - terms.sign * mkt.rate * strike * terms.discount * values.nd2
+                   + terms.sign * carry_rate * terms.discount * terms.forward * values.nd1) / DAYS_PER_YEAR;
+        store_lanes<V>(out.theta, i, select<V>(live, theta, zero));
+    }
+    if (out.rho) {
+        V rho = spot ? terms.sign * strike * expiry * terms.discount * values.nd2 : -expiry * values.price;
+        store_lanes<V>(out.rho, i, select<V>(live, rho * 0.01, zero));
+    }
+}
+
+template<typename V, typename Sqrt>
+LIBTRADIER_SIMD_INLINE size_t solve_lanes(const market& mkt, const contracts& rows, const double* price,
+                                          double* volatility, const solver_settings& settings, size_t i, Sqrt sqrt_of) {
+    using M = mask_of<V>;
+    V expiry = load<V>(rows.expiry + i);
+    V strike = load<V>(rows.strike + i);
+    V target = load<V>(price + i);
+    lane_terms<V> terms = make_lane_terms<V>(mkt, expiry, rows.right + i);
+    V zero = splat<V>(0.0);
+
+    V moneyness = terms.sign * (terms.forward - strike);
+    V lower = terms.discount * select<V>(moneyness > 0.0, moneyness, zero);
+    V upper = terms.discount * select<V>(terms.sign > 0.0, terms.forward, strike);
+    M active = (expiry > 0.0) & (target > lower) & (target < upper);
+    M converged{};
+
+    V sqrt_expiry = sqrt_of(select<V>(expiry > 0.0, expiry, splat<V>(1.0)));
+    V low = zero;
+    V high = splat<V>(settings.max_volatility);
+    V vol = 2.50662827463100050242 * target / (terms.discount * terms.forward * sqrt_expiry);
+    vol = select<V>(vol > 0.05, vol, splat<V>(0.05));
+    vol = select<V>(vol < 0.5 * high, vol, 0.5 * high);
+
+    for (int iteration = 0; iteration < settings.max_iterations && any<V>(active); ++iteration) {
+        lane_values<V> values = black<V>(terms, strike, sqrt_expiry, vol);
+        V diff = values.price - target;
+
+        M done = active & (abs<V>(diff) < settings.tolerance);
+        converged = converged | done;
+        active = active & ~done;
+
+        M above = diff > 0.0;
+        high = select<V>(active & above, vol, high);
+        low = select<V>(active & ~above, vol, low);
+        V vega = terms.discount * terms.forward * values.pdf * sqrt_expiry;
+        V next = vol - diff / vega;
+        next = select<V>((next > low) & (next < high), next, 0.5 * (low + high));
+        vol = select<V>(active, next, vol);
+    }
+
+    store_lanes<V>(volatility, i, select<V>(converged, vol, splat<V>(NOT_A_NUMBER)));
+    size_t count = 0;
+    for (size_t lane = 0; lane < lane_count<V>; ++lane) {
+        count += converged[lane] != 0;
+    }
+    return count;
+}
+
+#endif
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+struct sqrt_avx2 {
+    LIBTRADIER_SIMD_TARGET_AVX2 __m256d operator()(__m256d x) const { return _mm256_sqrt_pd(x); }
+};
+#endif
+
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+struct sqrt_avx512 {
+    LIBTRADIER_SIMD_TARGET_AVX512 __m512d operator()(__m512d x) const { return _mm512_maskz_sqrt_pd(0xFF, x); }
+};
+#endif
+
+}
+
+void price_impl::scalar(const market& mkt, const contracts& rows, const double* volatility, const outputs& out) {
+    price_rows(mkt, rows, volatility, out, 0, rows.count);
+}
+
+size_t implied_volatility_impl::scalar(const market& mkt, const contracts& rows, const double* price,
+                                       double* volatility, const solver_settings& settings) {
+    return solve_rows(mkt, rows, price, volatility, settings, 0, rows.count);
+}
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+// AVX2 implementations - 4 contracts per iteration, scalar tail
+
+LIBTRADIER_SIMD_TARGET_AVX2 void price_impl::avx2(const market& mkt, const contracts& rows, const double* volatility,
+                                                  const outputs& out) {
+    size_t i = 0;
+    for (; i + 4 <= rows.count; i += 4) {
+        price_lanes<__m256d>(mkt, rows, volatility, out, i, sqrt_avx2{});
+    }
+    price_rows(mkt, rows, volatility, out, i, rows.count);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX2 size_t implied_volatility_impl::avx2(const market& mkt, const contracts& rows,
+                                                                 const double* price, double* volatility,
+                                                                 const solver_settings& settings) {
+    size_t converged = 0;
+    size_t i = 0;
+    for (; i + 4 <= rows.count; i += 4) {
+        converged += solve_lanes<__m256d>(mkt, rows, price, volatility, settings, i, sqrt_avx2{});
+    }
+    return converged + solve_rows(mkt, rows, price, volatility, settings, i, rows.count);
+}
+#endif
+
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+// AVX-512 implementations - 8 contracts per iteration, scalar tail
+
+LIBTRADIER_SIMD_TARGET_AVX512 void price_impl::avx512(const market& mkt, const contracts& rows, const double* volatility,
+                                                      const outputs& out) {
+    size_t i = 0;
+    for (; i + 8 <= rows.count; i += 8) {
+        price_lanes<__m512d>(mkt, rows, volatility, out, i, sqrt_avx512{});
+    }
+    price_rows(mkt, rows, volatility, out, i, rows.count);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX512 size_t implied_volatility_impl::avx512(const market& mkt, const contracts& rows,
+                                                                     const double* price, double* volatility,
+                                                                     const solver_settings& settings) {
+    size_t converged = 0;
+    size_t i = 0;
+    for (; i + 8 <= rows.count; i += 8) {
+        converged += solve_lanes<__m512d>(mkt, rows, price, volatility, settings, i, sqrt_avx512{});
+    }
+    return converged + solve_rows(mkt, rows, price, volatility, settings, i, rows.count);
+}
+#endif
+
+void price(const market& mkt, const contracts& rows, const double* volatility, const outputs& out) {
+    simd_dispatcher<price_impl>::dispatch(mkt, rows, volatility, out);
+}
+
+size_t implied_volatility(const market& mkt, const contracts& rows, const double* price, double* volatility,
+                          const solver_settings& settings) {
+    return simd_dispatcher<implied_volatility_impl>::dispatch(mkt, rows, price, volatility, settings);
+}
+
+} // namespace pricing
+} // namespace simd
+} // namespace tradier
\ No newline at end of file
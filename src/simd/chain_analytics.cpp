@@ -0,0 +1,383 @@
+/*
+ * SIMD Option Chain Analytics Implementation
+ */
+
+#include "tradier/simd/chain_analytics.hpp"
+#include "tradier/market.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE || LIBTRADIER_SIMD_AVX512_AVAILABLE
+#include <immintrin.h>
+#endif
+
+namespace tradier {
+namespace simd {
+namespace chain {
+
+namespace {
+
+constexpr double NOT_A_NUMBER = std::numeric_limits<double>::quiet_NaN();
+
+// Unscaled sums shared by every variant; the caller applies S and S^2 / 100
+struct exposure_sums {
+    double delta = 0.0;
+    double gamma = 0.0;
+};
+
+void accumulate_exposure(exposure_sums& sums, const double* delta, const double* gamma,
+                         const int32_t* open_interest, const int32_t* contract_size, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        double contracts = static_cast<double>(open_interest[i]) * static_cast<double>(contract_size[i]);
+        sums.delta += delta[i] * contracts;
+        sums.gamma += gamma[i] * contracts;
+    }
+}
+
+greek_exposure scale_exposure(const exposure_sums& sums, double underlying) {
+    greek_exposure exposure;
+    exposure.dollar_delta = sums.delta * underlying;
+    exposure.dollar_gamma = sums.gamma * underlying * underlying * 0.01;
+    return exposure;
+}
+
+size_t mask_range(const double* values, double low, double high, uint8_t* mask, size_t begin, size_t end) {
+    size_t selected = 0;
+    for (size_t i = begin; i < end; ++i) {
+        bool inside = low <= values[i] && values[i] <= high;
+        mask[i] = inside ? 1 : 0;
+        selected += inside;
+    }
+    return selected;
+}
+
+size_t mask_abs_range(const double* values, double low, double high, uint8_t* mask, size_t begin, size_t end) {
+    size_t selected = 0;
+    for (size_t i = begin; i < end; ++i) {
+        double magnitude = std::fabs(values[i]);
+        bool inside = low <= magnitude && magnitude <= high;
+        mask[i] = inside ? 1 : 0;
+        selected += inside;
+    }
+    return selected;
+}
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE || LIBTRADIER_SIMD_AVX512_AVAILABLE
+
+// Comparison bits to one 0/1 byte per lane, lane 0 in the lowest byte
+template<typename Word, size_t Bits>
+constexpr std::array<Word, (1u << Bits)> make_byte_masks() {
+    std::array<Word, (1u << Bits)> table{};
+    for (size_t bits = 0; bits < table.size(); ++bits) {
+        Word word = 0;
+        for (size_t lane = 0; lane < Bits; ++lane) {
+            if (bits & (size_t{1} << lane)) {
+                word |= Word{1} << (lane * 8);
+            }
+        }
+        table[bits] = word;
+    }
+    return table;
+}
+
+#endif
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+
+constexpr auto BYTE_MASKS_4 = make_byte_masks<uint32_t, 4>();
+
+size_t store_mask4(int bits, uint8_t* mask) {
+    std::memcpy(mask, &BYTE_MASKS_4[static_cast<size_t>(bits)], sizeof(uint32_t));
+    return static_cast<size_t>(std::popcount(static_cast<unsigned>(bits)));
+}
+
+#endif
+
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+
+constexpr auto BYTE_MASKS_8 = make_byte_masks<uint64_t, 8>();
+
+size_t store_mask8(__mmask8 bits, uint8_t* mask) {
+    std::memcpy(mask, &BYTE_MASKS_8[bits], sizeof(uint64_t));
+    return static_cast<size_t>(std::popcount(static_cast<unsigned>(bits)));
+}
+
+#endif
+
+}
+
+// Scalar implementations
+
+void mid_price_impl::scalar(const double* bid, const double* ask, double* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = (bid[i] + ask[i]) * 0.5;
+    }
+}
+
+void relative_spread_impl::scalar(const double* bid, const double* ask, double* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        double mid = (bid[i] + ask[i]) * 0.5;
+        out[i] = mid > 0.0 ? (ask[i] - bid[i]) / mid : NOT_A_NUMBER;
+    }
+}
+
+void moneyness_impl::scalar(const double* strike, double underlying, double* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = strike[i] / underlying;
+    }
+}
+
+greek_exposure greek_exposure_impl::scalar(const double* delta, const double* gamma, const int32_t* open_interest,
+                                           const int32_t* contract_size, double underlying, size_t count) {
+    exposure_sums sums;
+    accumulate_exposure(sums, delta, gamma, open_interest, contract_size, 0, count);
+    return scale_exposure(sums, underlying);
+}
+
+size_t range_mask_impl::scalar(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    return mask_range(values, low, high, mask, 0, count);
+}
+
+size_t abs_range_mask_impl::scalar(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    return mask_abs_range(values, low, high, mask, 0, count);
+}
+
+#if LIBTRADIER_SIMD_AVX2_AVAILABLE
+// AVX2 implementations - 4 doubles per register
+
+LIBTRADIER_SIMD_TARGET_AVX2 void mid_price_impl::avx2(const double* bid, const double* ask, double* out, size_t count) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d sum = _mm256_add_pd(_mm256_loadu_pd(bid + i), _mm256_loadu_pd(ask + i));
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(sum, half));
+    }
+    scalar(bid + i, ask + i, out + i, count - i);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX2 void relative_spread_impl::avx2(const double* bid, const double* ask, double* out, size_t count) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d nan = _mm256_set1_pd(NOT_A_NUMBER);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d b = _mm256_loadu_pd(bid + i);
+        __m256d a = _mm256_loadu_pd(ask + i);
+        __m256d mid = _mm256_mul_pd(_mm256_add_pd(b, a), half);
+        __m256d spread = _mm256_div_pd(_mm256_sub_pd(a, b), mid);
+        __m256d quoted = _mm256_cmp_pd(mid, zero, _CMP_GT_OQ);
+        _mm256_storeu_pd(out + i, _mm256_blendv_pd(nan, spread, quoted));
+    }
+    scalar(bid + i, ask + i, out + i, count - i);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX2 void moneyness_impl::avx2(const double* strike, double underlying, double* out, size_t count) {
+    const __m256d spot = _mm256_set1_pd(underlying);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_div_pd(_mm256_loadu_pd(strike + i), spot));
+    }
+    scalar(strike + i, underlying, out + i, count - i);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX2 greek_exposure greek_exposure_impl::avx2(const double* delta, const double* gamma, const int32_t* open_interest,
+                                                                     const int32_t* contract_size, double underlying, size_t count) {
+    __m256d deltaSum = _mm256_setzero_pd();
+    __m256d gammaSum = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d oi = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(open_interest + i)));
+        __m256d size = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(contract_size + i)));
+        __m256d contracts = _mm256_mul_pd(oi, size);
+        deltaSum = _mm256_add_pd(deltaSum, _mm256_mul_pd(_mm256_loadu_pd(delta + i), contracts));
+        gammaSum = _mm256_add_pd(gammaSum, _mm256_mul_pd(_mm256_loadu_pd(gamma + i), contracts));
+    }
+
+    alignas(32) double lanes[8];
+    _mm256_store_pd(lanes, deltaSum);
+    _mm256_store_pd(lanes + 4, gammaSum);
+    exposure_sums sums;
+    sums.delta = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    sums.gamma = (lanes[4] + lanes[5]) + (lanes[6] + lanes[7]);
+    accumulate_exposure(sums, delta, gamma, open_interest, contract_size, i, count);
+    return scale_exposure(sums, underlying);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX2 size_t range_mask_impl::avx2(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    const __m256d lo = _mm256_set1_pd(low);
+    const __m256d hi = _mm256_set1_pd(high);
+    size_t selected = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d v = _mm256_loadu_pd(values + i);
+        __m256d inside = _mm256_and_pd(_mm256_cmp_pd(v, lo, _CMP_GE_OQ), _mm256_cmp_pd(v, hi, _CMP_LE_OQ));
+        selected += store_mask4(_mm256_movemask_pd(inside), mask + i);
+    }
+    return selected + mask_range(values, low, high, mask, i, count);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX2 size_t abs_range_mask_impl::avx2(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    const __m256d lo = _mm256_set1_pd(low);
+    const __m256d hi = _mm256_set1_pd(high);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    size_t selected = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d v = _mm256_andnot_pd(sign, _mm256_loadu_pd(values + i));
+        __m256d inside = _mm256_and_pd(_mm256_cmp_pd(v, lo, _CMP_GE_OQ), _mm256_cmp_pd(v, hi, _CMP_LE_OQ));
+        selected += store_mask4(_mm256_movemask_pd(inside), mask + i);
+    }
+    return selected + mask_abs_range(values, low, high, mask, i, count);
+}
+#endif
+
+#if LIBTRADIER_SIMD_AVX512_AVAILABLE
+// AVX-512 implementations - 8 doubles per register, comparisons straight to k-masks
+
+LIBTRADIER_SIMD_TARGET_AVX512 void mid_price_impl::avx512(const double* bid, const double* ask, double* out, size_t count) {
+    const __m512d half = _mm512_set1_pd(0.5);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512d sum = _mm512_add_pd(_mm512_loadu_pd(bid + i), _mm512_loadu_pd(ask + i));
+        _mm512_storeu_pd(out + i, _mm512_mul_pd(sum, half));
+    }
+    scalar(bid + i, ask + i, out + i, count - i);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX512 void relative_spread_impl::avx512(const double* bid, const double* ask, double* out, size_t count) {
+    const __m512d half = _mm512_set1_pd(0.5);
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d nan = _mm512_set1_pd(NOT_A_NUMBER);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512d b = _mm512_loadu_pd(bid + i);
+        __m512d a = _mm512_loadu_pd(ask + i);
+        __m512d mid = _mm512_mul_pd(_mm512_add_pd(b, a), half);
+        __mmask8 quoted = _mm512_cmp_pd_mask(mid, zero, _CMP_GT_OQ);
+        __m512d spread = _mm512_mask_div_pd(nan, quoted, _mm512_sub_pd(a, b), mid);
+        _mm512_storeu_pd(out + i, spread);
+    }
+    scalar(bid + i, ask + i, out + i, count - i);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX512 void moneyness_impl::avx512(const double* strike, double underlying, double* out, size_t count) {
+    const __m512d spot = _mm512_set1_pd(underlying);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_div_pd(_mm512_loadu_pd(strike + i), spot));
+    }
+    scalar(strike + i, underlying, out + i, count - i);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX512 greek_exposure greek_exposure_impl::avx512(const double* delta, const double* gamma, const int32_t* open_interest,
+                                                                         const int32_t* contract_size, double underlying, size_t count) {
+    __m512d deltaSum = _mm512_setzero_pd();
+    __m512d gammaSum = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        // maskz forms: the plain ones trip GCC 12's uninitialized warnings under target attributes
+        __m512d oi = _mm512_maskz_cvtepi32_pd(0xFF, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(open_interest + i)));
+        __m512d size = _mm512_maskz_cvtepi32_pd(0xFF, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(contract_size + i)));
+        __m512d contracts = _mm512_mul_pd(oi, size);
+        deltaSum = _mm512_add_pd(deltaSum, _mm512_mul_pd(_mm512_loadu_pd(delta + i), contracts));
+        gammaSum = _mm512_add_pd(gammaSum, _mm512_mul_pd(_mm512_loadu_pd(gamma + i), contracts));
+    }
+
+    alignas(64) double lanes[16];
+    _mm512_store_pd(lanes, deltaSum);
+    _mm512_store_pd(lanes + 8, gammaSum);
+    exposure_sums sums;
+    for (size_t lane = 0; lane < 8; ++lane) {
+        sums.delta += lanes[lane];
+        sums.gamma += lanes[8 + lane];
+    }
+    accumulate_exposure(sums, delta, gamma, open_interest, contract_size, i, count);
+    return scale_exposure(sums, underlying);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX512 size_t range_mask_impl::avx512(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    const __m512d lo = _mm512_set1_pd(low);
+    const __m512d hi = _mm512_set1_pd(high);
+    size_t selected = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512d v = _mm512_loadu_pd(values + i);
+        __mmask8 inside = _mm512_mask_cmp_pd_mask(_mm512_cmp_pd_mask(v, lo, _CMP_GE_OQ), v, hi, _CMP_LE_OQ);
+        selected += store_mask8(inside, mask + i);
+    }
+    return selected + mask_range(values, low, high, mask, i, count);
+}
+
+LIBTRADIER_SIMD_TARGET_AVX512 size_t abs_range_mask_impl::avx512(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    const __m512d lo = _mm512_set1_pd(low);
+    const __m512d hi = _mm512_set1_pd(high);
+    size_t selected = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512d v = _mm512_abs_pd(_mm512_loadu_pd(values + i));
+        __mmask8 inside = _mm512_mask_cmp_pd_mask(_mm512_cmp_pd_mask(v, lo, _CMP_GE_OQ), v, hi, _CMP_LE_OQ);
+        selected += store_mask8(inside, mask + i);
+    }
+    return selected + mask_abs_range(values, low, high, mask, i, count);
+}
+#endif
+
+// Dispatch happens here, inside the library, so the variant set does not
+// depend on the caller's compiler flags
+
+void mid_price(const double* bid, const double* ask, double* out, size_t count) {
+    simd_dispatcher<mid_price_impl>::dispatch(bid, ask, out, count);
+}
+
+void relative_spread(const double* bid, const double* ask, double* out, size_t count) {
+    simd_dispatcher<relative_spread_impl>::dispatch(bid, ask, out, count);
+}
+
+void moneyness(const double* strike, double underlying, double* out, size_t count) {
+    simd_dispatcher<moneyness_impl>::dispatch(strike, underlying, out, count);
+}
+
+greek_exposure greek_exposure_sum(const double* delta, const double* gamma, const int32_t* open_interest,
+                                  const int32_t* contract_size, double underlying, size_t count) {
+    return simd_dispatcher<greek_exposure_impl>::dispatch(delta, gamma, open_interest, contract_size, underlying, count);
+}
+
+size_t range_mask(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    return simd_dispatcher<range_mask_impl>::dispatch(values, low, high, mask, count);
+}
+
+size_t abs_range_mask(const double* values, double low, double high, uint8_t* mask, size_t count) {
+    return simd_dispatcher<abs_range_mask_impl>::dispatch(values, low, high, mask, count);
+}
+
+void mid_price(const OptionChainColumns& columns, double* out) {
+    mid_price(columns.bid.data(), columns.ask.data(), out, columns.size());
+}
+
+void relative_spread(const OptionChainColumns& columns, double* out) {
+    relative_spread(columns.bid.data(), columns.ask.data(), out, columns.size());
+}
+
+void moneyness(const OptionChainColumns& columns, double underlying, double* out) {
+    moneyness(columns.strike.data(), underlying, out, columns.size());
+}
+
+greek_exposure greek_exposure_sum(const OptionChainColumns& columns, double underlying) {
+    return greek_exposure_sum(columns.delta.data(), columns.gamma.data(), columns.openInterest.data(),
+                              columns.contractSize.data(), underlying, columns.size());
+}
+
+size_t strike_range_mask(const OptionChainColumns& columns, double low, double high, uint8_t* mask) {
+    return range_mask(columns.strike.data(), low, high, mask, columns.size());
+}
+
+size_t delta_band_mask(const OptionChainColumns& columns, double low, double high, uint8_t* mask) {
+    return abs_range_mask(columns.delta.data(), low, high, mask, columns.size());
+}
+
+} // namespace chain
+} // namespace simd
+} // namespace tradier
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * SIMD Runtime CPU Feature Selection Implementation
+ */
+
+#include "tradier/simd/cpu_features.hpp"
+#include "tradier/simd/simd_config.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace tradier {
+namespace simd {
+
+namespace {
+
+isa detect() {
+#if LIBTRADIER_SIMD_RUNTIME_DISPATCH
+    // libgcc's checks include OS support for the wider register state (XGETBV)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+        return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return isa::avx2;
+    }
+    return isa::scalar;
+#elif LIBTRADIER_SIMD_ACTIVE && LIBTRADIER_SIMD_AVX512_AVAILABLE
+    return isa::avx512;
+#elif LIBTRADIER_SIMD_ACTIVE && LIBTRADIER_SIMD_AVX2_AVAILABLE
+    return isa::avx2;
+#else
+    return isa::scalar;
+#endif
+}
+
+isa cap(isa requested, isa limit) {
+    return static_cast<uint8_t>(requested) < static_cast<uint8_t>(limit) ? requested : limit;
+}
+
+isa initial() {
+    isa best = detected_isa();
+    const char* forced = std::getenv("LIBTRADIER_SIMD_ISA");
+    if (forced == nullptr) {
+        return best;
+    }
+    for (isa candidate : {isa::scalar, isa::avx2, isa::avx512}) {
+        if (std::strcmp(forced, isa_name(candidate)) == 0) {
+            return cap(candidate, best);
+        }
+    }
+    return best;
+}
+
+std::atomic<isa>& active() {
+    static std::atomic<isa> value{initial()};
+    return value;
+}
+
+}
+
+isa detected_isa() {
+    static const isa value = detect();
+    return value;
+}
+
+isa active_isa() {
+    return active().load(std::memory_order_relaxed);
+}
+
+isa select_isa(isa requested) {
+    isa selected = cap(requested, detected_isa());
+    active().store(selected, std::memory_order_relaxed);
+    return selected;
+}
+
+const char* isa_name(isa value) {
+    switch (value) {
+        case isa::avx512: return "avx512";
+        case isa::avx2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+} // namespace simd
+} // namespace tradier
@@ -41,7 +41,7 @@ size_t bulk_string_to_double_impl::scalar(const nlohmann::json* json_strings, do
 
 #if LIBTRADIER_SIMD_AVX2_AVAILABLE
 // AVX2 implementation - processes 4 doubles at once
-size_t bulk_string_to_double_impl::avx2(const nlohmann::json* json_strings, double* output, size_t count) {
+LIBTRADIER_SIMD_TARGET_AVX2 size_t bulk_string_to_double_impl::avx2(const nlohmann::json* json_strings, double* output, size_t count) {
         size_t converted = 0;
         
         // Process in chunks of 4 for AVX2
@@ -108,7 +108,7 @@ size_t bulk_string_to_double_impl::avx2(const nlohmann::json* json_strings, doub
 
 #if LIBTRADIER_SIMD_AVX512_AVAILABLE
 // AVX-512 implementation - processes 8 doubles at once
-size_t bulk_string_to_double_impl::avx512(const nlohmann::json* json_strings, double* output, size_t count) {
+LIBTRADIER_SIMD_TARGET_AVX512 size_t bulk_string_to_double_impl::avx512(const nlohmann::json* json_strings, double* output, size_t count) {
         // For now, fall back to scalar
         // TODO: Implement true AVX-512 string parsing
         return scalar(json_strings, output, count);
@@ -194,7 +194,7 @@ size_t bulk_process_events_impl::scalar(const nlohmann::json* events, size_t cou
 
 #if LIBTRADIER_SIMD_AVX2_AVAILABLE
 // AVX2 implementation for bulk_process_events
-size_t bulk_process_events_impl::avx2(const nlohmann::json* events, size_t count,
+LIBTRADIER_SIMD_TARGET_AVX2 size_t bulk_process_events_impl::avx2(const nlohmann::json* events, size_t count,
                                      std::function<void(const tradier::TradeEvent&)> tradeHandler,
                                      std::function<void(const tradier::QuoteEvent&)> quoteHandler) {
     std::cerr << "SIMD: AVX2 implementation called with " << count << " events" << std::endl;
@@ -333,7 +333,7 @@ size_t bulk_process_events_impl::avx2(const nlohmann::json* events, size_t count
 
 #if LIBTRADIER_SIMD_AVX512_AVAILABLE
 // AVX-512 implementation for bulk_process_events
-size_t bulk_process_events_impl::avx512(const nlohmann::json* events, size_t count,
+LIBTRADIER_SIMD_TARGET_AVX512 size_t bulk_process_events_impl::avx512(const nlohmann::json* events, size_t count,
                                        std::function<void(const tradier::TradeEvent&)> tradeHandler,
                                        std::function<void(const tradier::QuoteEvent&)> quoteHandler) {
     // For now, fall back to AVX2 implementation
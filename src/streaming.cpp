@@ -10,29 +10,80 @@
  */
 
 
+#include <algorithm>
 #include <atomic>
+#include <charconv>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
 #include <queue>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <variant>
 #include <vector>
 
 #include "tradier/client.hpp"
 #include "tradier/common/debug.hpp"
 #include "tradier/common/errors.hpp"
+#include "tradier/common/event_ring.hpp"
 #include "tradier/common/json_utils.hpp"
 #include "tradier/common/websocket_client.hpp"
 #include "tradier/json/streaming.hpp"
+#include "tradier/market_state.hpp"
 #include "tradier/streaming.hpp"
 
 
 namespace tradier {
 
+SymbolId SymbolTable::intern(std::string_view symbol) {
+    {
+        std::shared_lock lock(mutex_);
+        auto it = ids_.find(symbol);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+    }
+    
+    std::unique_lock lock(mutex_);
+    auto it = ids_.find(symbol);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    
+    auto id = static_cast<SymbolId>(names_.size());
+    const std::string& stored = names_.emplace_back(symbol);
+    ids_.emplace(stored, id);
+    return id;
+}
+
+std::optional<SymbolId> SymbolTable::find(std::string_view symbol) const {
+    std::shared_lock lock(mutex_);
+    auto it = ids_.find(symbol);
+    if (it == ids_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::string_view SymbolTable::name(SymbolId id) const {
+    std::shared_lock lock(mutex_);
+    if (id >= names_.size()) {
+        return {};
+    }
+    return names_[id];
+}
+
+size_t SymbolTable::size() const {
+    std::shared_lock lock(mutex_);
+    return names_.size();
+}
+
 class ThreadManager {
 private:
     std::atomic<bool> shouldStop_{false};
@@ -171,6 +222,297 @@ public:
     }
 };
 
+using StreamEvent = std::variant<
+    std::monostate,
+    TradeEvent, QuoteEvent, SummaryEvent, TimesaleEvent,
+    CompactTradeEvent, CompactQuoteEvent, CompactTimesaleEvent
+>;
+
+// Frame arrival time (steady clock, 0 when latency is not recorded) travels
+// with the event so consumers can record how long it waited for its handler
+struct QueuedEvent {
+    StreamEvent event;
+    int64_t receivedNs = 0;
+};
+
+template<typename Event, typename Variant>
+struct VariantIndex;
+
+template<typename Event, typename... Types>
+struct VariantIndex<Event, std::variant<Types...>> {
+    static constexpr size_t value = [] {
+        size_t index = 0;
+        ((std::is_same_v<Event, Types> ? false : (++index, true)) && ...);
+        return index;
+    }();
+};
+
+// Newest event per (type, symbol), handed out in the order the keys first
+// became pending. Slots persist per key so their strings keep capacity.
+class ConflationSlots {
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, size_t> index_;
+    std::vector<QueuedEvent> latest_;
+    std::vector<size_t> dirty_;
+    std::vector<bool> isDirty_;
+    std::atomic<size_t> pending_{0};
+    std::string key_;
+
+public:
+    // Returns true when an undelivered event for the key was replaced
+    template<typename Event>
+    bool put(const Event& event, std::string_view symbol, int64_t receivedNs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        key_.assign(1, static_cast<char>(VariantIndex<Event, StreamEvent>::value));
+        key_.append(symbol);
+        
+        auto [it, inserted] = index_.try_emplace(key_, latest_.size());
+        if (inserted) {
+            latest_.emplace_back();
+            isDirty_.push_back(false);
+        }
+        
+        size_t slot = it->second;
+        if (auto* existing = std::get_if<Event>(&latest_[slot].event)) {
+            *existing = event;
+        } else {
+            latest_[slot].event.template emplace<Event>(event);
+        }
+        latest_[slot].receivedNs = receivedNs;
+        
+        if (isDirty_[slot]) {
+            return true;
+        }
+        isDirty_[slot] = true;
+        dirty_.push_back(slot);
+        pending_.store(dirty_.size(), std::memory_order_release);
+        return false;
+    }
+    
+    size_t pending() const {
+        return pending_.load(std::memory_order_acquire);
+    }
+    
+    // Appends the pending events to batch, swapping them out of their slots
+    void take(std::vector<QueuedEvent>& batch) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t slot : dirty_) {
+            batch.emplace_back();
+            std::swap(batch.back(), latest_[slot]);
+            isDirty_[slot] = false;
+        }
+        dirty_.clear();
+        pending_.store(0, std::memory_order_release);
+    }
+};
+
+// QUEUED dispatch: the socket thread publishes decoded events into a ring and
+// consumer threads run the handlers. Overflow entries (CONFLATE) are delivered
+// once the ring has drained; while any are pending, new events conflate too
+// so delivery stays newest-last. With conflateQuotes, quotes skip the ring
+// and are picked up between ring events.
+class EventDispatcher {
+public:
+    using Deliver = std::function<void(QueuedEvent&)>;
+
+private:
+    EventRing<QueuedEvent> ring_;
+    OverflowPolicy policy_;
+    bool conflateQuotes_;
+    StreamStatistics& stats_;
+    Deliver deliver_;
+    
+    std::atomic<uint32_t> published_{0};
+    std::atomic<uint32_t> consumed_{0};
+    std::atomic<bool> stopping_{false};
+    
+    ConflationSlots overflow_;
+    ConflationSlots quotes_;
+    
+    // Producer-side scratch
+    QueuedEvent discarded_;
+    
+    std::vector<std::thread> consumers_;
+    
+    void signalPublished() {
+        published_.fetch_add(1, std::memory_order_release);
+        published_.notify_one();
+    }
+    
+    template<typename Fill>
+    void pushBlocking(Fill& fill) {
+        stats_.producerStalls++;
+        for (;;) {
+            uint32_t seen = consumed_.load(std::memory_order_acquire);
+            if (ring_.tryPush(fill)) {
+                return;
+            }
+            consumed_.wait(seen, std::memory_order_acquire);
+        }
+    }
+    
+    template<typename Fill>
+    void pushDroppingOldest(Fill& fill) {
+        while (!ring_.tryPush(fill)) {
+            if (ring_.tryPop([this](QueuedEvent& slot) { std::swap(discarded_, slot); })) {
+                stats_.eventsDropped++;
+            }
+        }
+    }
+    
+    template<typename Event>
+    void conflateOverflow(const Event& event, std::string_view symbol, int64_t receivedNs) {
+        if (overflow_.put(event, symbol, receivedNs)) {
+            stats_.eventsConflated++;
+        }
+        signalPublished();
+    }
+    
+    bool deliverPending(ConflationSlots& slots, std::vector<QueuedEvent>& batch) {
+        if (slots.pending() == 0) {
+            return false;
+        }
+        
+        slots.take(batch);
+        for (auto& event : batch) {
+            deliver_(event);
+        }
+        bool delivered = !batch.empty();
+        batch.clear();
+        return delivered;
+    }
+    
+    void consume() {
+        QueuedEvent local;
+        std::vector<QueuedEvent> batch;
+        
+        for (;;) {
+            uint32_t seen = published_.load(std::memory_order_acquire);
+            bool progressed = false;
+            
+            if (ring_.tryPop([&local](QueuedEvent& slot) { std::swap(local, slot); })) {
+                consumed_.fetch_add(1, std::memory_order_release);
+                consumed_.notify_one();
+                deliver_(local);
+                progressed = true;
+            }
+            
+            progressed |= deliverPending(quotes_, batch);
+            
+            if (progressed) {
+                continue;
+            }
+            
+            if (deliverPending(overflow_, batch)) {
+                continue;
+            }
+            
+            if (stopping_.load(std::memory_order_acquire)) {
+                break;
+            }
+            
+            published_.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+public:
+    EventDispatcher(const StreamingConfig& config, StreamStatistics& stats, Deliver deliver)
+        : ring_(std::max<size_t>(config.queueCapacity, 2)),
+          policy_(config.overflowPolicy),
+          conflateQuotes_(config.conflateQuotes),
+          stats_(stats),
+          deliver_(std::move(deliver)) {
+        int threads = std::max(config.consumerThreads, 1);
+        consumers_.reserve(static_cast<size_t>(threads));
+        for (int i = 0; i < threads; ++i) {
+            consumers_.emplace_back([this]() { consume(); });
+        }
+    }
+    
+    ~EventDispatcher() {
+        stop();
+    }
+    
+    EventDispatcher(const EventDispatcher&) = delete;
+    EventDispatcher& operator=(const EventDispatcher&) = delete;
+    
+    // Single producer: only the connection's read thread publishes
+    template<typename Event>
+    void publish(const Event& event, std::string_view symbol, int64_t receivedNs) {
+        if constexpr (std::is_same_v<Event, QuoteEvent> || std::is_same_v<Event, CompactQuoteEvent>) {
+            if (conflateQuotes_) {
+                if (quotes_.put(event, symbol, receivedNs)) {
+                    stats_.quotesConflated++;
+                }
+                signalPublished();
+                return;
+            }
+        }
+        
+        if (policy_ == OverflowPolicy::CONFLATE && overflow_.pending() > 0) {
+            conflateOverflow(event, symbol, receivedNs);
+            return;
+        }
+        
+        auto fill = [&event, receivedNs](QueuedEvent& slot) {
+            if (auto* existing = std::get_if<Event>(&slot.event)) {
+                *existing = event;
+            } else {
+                slot.event.template emplace<Event>(event);
+            }
+            slot.receivedNs = receivedNs;
+        };
+        
+        if (!ring_.tryPush(fill)) {
+            switch (policy_) {
+                case OverflowPolicy::BLOCK:
+                    pushBlocking(fill);
+                    break;
+                case OverflowPolicy::DROP_OLDEST:
+                    pushDroppingOldest(fill);
+                    break;
+                case OverflowPolicy::CONFLATE:
+                    conflateOverflow(event, symbol, receivedNs);
+                    return;
+            }
+        }
+        
+        stats_.eventsQueued++;
+        auto depth = static_cast<long>(ring_.size());
+        if (depth > stats_.queueHighWater.load(std::memory_order_relaxed)) {
+            stats_.queueHighWater.store(depth, std::memory_order_relaxed);
+        }
+        signalPublished();
+    }
+    
+    // Consumers drain whatever is queued before exiting
+    void stop() {
+        if (stopping_.exchange(true)) {
+            return;
+        }
+        published_.fetch_add(1, std::memory_order_release);
+        published_.notify_all();
+        
+        for (auto& consumer : consumers_) {
+            if (consumer.joinable()) {
+                consumer.join();
+            }
+        }
+        consumers_.clear();
+    }
+};
+
+// Lets the filters be probed with the string_views the decoders produce
+struct FilterHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const {
+        return std::hash<std::string_view>{}(value);
+    }
+};
+
+using FilterSet = std::unordered_set<std::string, FilterHash, std::equal_to<>>;
+
 class StreamingService::Impl {
 public:
     TradierClient& client;
@@ -185,10 +527,16 @@ public:
     AccountOrderEventHandler orderHandler;
     AccountPositionEventHandler positionHandler;
     ErrorHandler errorHandler;
+    
+    CompactTradeEventHandler compactTradeHandler;
+    CompactQuoteEventHandler compactQuoteHandler;
+    CompactTimesaleEventHandler compactTimesaleHandler;
+    std::shared_ptr<SymbolTable> symbolTable = std::make_shared<SymbolTable>();
+    std::shared_ptr<MarketStateCache> marketState;
 
     std::unordered_set<std::string> subscribedSymbols;
-    std::unordered_set<std::string> symbolFilter;
-    std::unordered_set<std::string> exchangeFilter;
+    FilterSet symbolFilter;
+    FilterSet exchangeFilter;
     mutable std::mutex subscriptionMutex;
 
     ThreadManager threadManager;
@@ -199,6 +547,16 @@ public:
 
     StreamSession currentSession;
     
+    // Set before the connection starts reading and reset after it stops
+    std::unique_ptr<EventDispatcher> dispatcher;
+    
+    // Only touched from the connection's read thread
+    json::StreamEventBuffer decodedEvent;
+    json::CompactEventBuffer compactEvent;
+    bool timingFrame = false;
+    int64_t receivedWallNs = 0;
+    int64_t receivedNs = 0;
+    
     explicit Impl(TradierClient& c) : client(c) {
         config.autoReconnect = true;
         config.reconnectDelay = 5000;
@@ -233,13 +591,46 @@ private:
     }
 
 public:
-    void handleMessage(const std::string& message) {
+    void handleMessage(std::string_view message) {
+        receivedWallNs = StreamStatistics::nowNanos();
         stats.messagesReceived++;
-        stats.setLastMessage(std::chrono::system_clock::now());
+        stats.setLastMessageNanos(receivedWallNs);
+        
+        timingFrame = config.recordLatency;
+        receivedNs = timingFrame ? steadyNanos() : 0;
+        
+        bool fastPath = true;
+        bool timed = false;
+        bool compactPending = compactTradeHandler || compactQuoteHandler || compactTimesaleHandler || marketState;
+        if (compactPending) {
+            auto status = json::decodeCompactStreamEvent(message, *symbolTable, compactEvent);
+            fastPath = status != json::StreamDecodeStatus::UNSUPPORTED;
+            if (fastPath) {
+                compactPending = false;
+                timed = timingFrame && recordFeedLatency(compactEventTimeMs(status));
+                dispatchCompactEvent(status);
+            }
+        }
+        
+        if (fastPath && (tradeHandler || quoteHandler || summaryHandler || timesaleHandler)) {
+            auto status = json::decodeStreamEvent(message, decodedEvent);
+            fastPath = status != json::StreamDecodeStatus::UNSUPPORTED;
+            if (fastPath) {
+                if (timingFrame && !timed) {
+                    recordFeedLatency(decodedEventTimeMs(status));
+                }
+                dispatchDecodedEvent(status);
+            }
+        }
+        
+        if (fastPath) {
+            stats.messagesProcessed++;
+            return;
+        }
         
         try {
-            auto json = nlohmann::json::parse(message);
-            processEvent(json);
+            auto json = nlohmann::json::parse(message.begin(), message.end());
+            processEvent(json, compactPending);
             stats.messagesProcessed++;
         } catch (const std::exception& e) {
             stats.errors++;
@@ -249,7 +640,186 @@ public:
         }
     }
     
-    void processEvent(const nlohmann::json& json) {
+    int64_t compactEventTimeMs(json::StreamDecodeStatus status) const {
+        switch (status) {
+            case json::StreamDecodeStatus::TRADE:
+                return compactEvent.trade.timestampMs;
+            case json::StreamDecodeStatus::QUOTE:
+                return std::max(compactEvent.quote.bidTimeMs, compactEvent.quote.askTimeMs);
+            case json::StreamDecodeStatus::TIMESALE:
+                return compactEvent.timesale.timestampMs;
+            default:
+                return 0;
+        }
+    }
+    
+    int64_t decodedEventTimeMs(json::StreamDecodeStatus status) const {
+        switch (status) {
+            case json::StreamDecodeStatus::TRADE:
+                return parseEpochMillis(decodedEvent.trade.date);
+            case json::StreamDecodeStatus::QUOTE:
+                return std::max(parseEpochMillis(decodedEvent.quote.bidDate), parseEpochMillis(decodedEvent.quote.askDate));
+            case json::StreamDecodeStatus::TIMESALE:
+                return parseEpochMillis(decodedEvent.timesale.date);
+            default:
+                return 0;
+        }
+    }
+    
+    static int64_t parseEpochMillis(std::string_view date) {
+        int64_t millis = 0;
+        std::from_chars(date.data(), date.data() + date.size(), millis);
+        return millis;
+    }
+    
+    static int64_t steadyNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    
+    // Exchange timestamps are wall-clock, so this is the one measurement
+    // taken against the system clock
+    bool recordFeedLatency(int64_t eventTimeMs) {
+        int64_t latency = receivedWallNs - eventTimeMs * 1000000;
+        if (eventTimeMs <= 0 || latency < 0) {
+            return false;
+        }
+        stats.feedLatency.record(static_cast<uint64_t>(latency));
+        return true;
+    }
+    
+    void recordDispatchLatency(int64_t received) {
+        stats.dispatchLatency.record(static_cast<uint64_t>(steadyNanos() - received));
+    }
+    
+    template<typename Event, typename Handler>
+    void emit(const Event& event, const Handler& handler, std::string_view symbol) {
+        if (dispatcher) {
+            dispatcher->publish(event, symbol, receivedNs);
+        } else {
+            if (timingFrame) {
+                recordDispatchLatency(receivedNs);
+            }
+            handler(event);
+        }
+    }
+    
+    void invokeHandler(const std::monostate&) {}
+    void invokeHandler(const TradeEvent& event) { if (tradeHandler) tradeHandler(event); }
+    void invokeHandler(const QuoteEvent& event) { if (quoteHandler) quoteHandler(event); }
+    void invokeHandler(const SummaryEvent& event) { if (summaryHandler) summaryHandler(event); }
+    void invokeHandler(const TimesaleEvent& event) { if (timesaleHandler) timesaleHandler(event); }
+    void invokeHandler(const CompactTradeEvent& event) { if (compactTradeHandler) compactTradeHandler(event); }
+    void invokeHandler(const CompactQuoteEvent& event) { if (compactQuoteHandler) compactQuoteHandler(event); }
+    void invokeHandler(const CompactTimesaleEvent& event) { if (compactTimesaleHandler) compactTimesaleHandler(event); }
+    
+    // Runs on the dispatcher's consumer threads
+    void deliverEvent(QueuedEvent& queued) {
+        if (queued.receivedNs != 0) {
+            recordDispatchLatency(queued.receivedNs);
+        }
+        try {
+            std::visit([this](const auto& value) { invokeHandler(value); }, queued.event);
+        } catch (const std::exception& e) {
+            stats.errors++;
+            if (errorHandler) {
+                errorHandler("Event processing error: " + std::string(e.what()));
+            }
+        }
+    }
+    
+    bool passesFilters(std::string_view symbol, bool hasExchange, std::string_view exchange) const {
+        if (!symbolFilter.empty() && symbolFilter.find(symbol) == symbolFilter.end()) {
+            return false;
+        }
+        
+        if (!exchangeFilter.empty() && hasExchange && exchangeFilter.find(exchange) == exchangeFilter.end()) {
+            return false;
+        }
+        
+        return true;
+    }
+    
+    bool passesFilters(const std::string& symbol) const {
+        return passesFilters(symbol, decodedEvent.hasExchange, decodedEvent.exchange);
+    }
+    
+    void dispatchCompactEvent(json::StreamDecodeStatus status) {
+        if (!passesFilters(compactEvent.symbol, compactEvent.hasExchange, compactEvent.exchange)) {
+            return;
+        }
+        
+        if (marketState) {
+            if (status == json::StreamDecodeStatus::QUOTE) {
+                marketState->apply(compactEvent.quote);
+            } else if (status == json::StreamDecodeStatus::TRADE) {
+                marketState->apply(compactEvent.trade);
+            }
+        }
+        
+        try {
+            switch (status) {
+                case json::StreamDecodeStatus::TRADE:
+                    if (compactTradeHandler) {
+                        emit(compactEvent.trade, compactTradeHandler, compactEvent.symbol);
+                    }
+                    break;
+                case json::StreamDecodeStatus::QUOTE:
+                    if (compactQuoteHandler) {
+                        emit(compactEvent.quote, compactQuoteHandler, compactEvent.symbol);
+                    }
+                    break;
+                case json::StreamDecodeStatus::TIMESALE:
+                    if (compactTimesaleHandler) {
+                        emit(compactEvent.timesale, compactTimesaleHandler, compactEvent.symbol);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        } catch (const std::exception& e) {
+            if (errorHandler) {
+                errorHandler("Event processing error: " + std::string(e.what()));
+            }
+        }
+    }
+    
+    void dispatchDecodedEvent(json::StreamDecodeStatus status) {
+        try {
+            switch (status) {
+                case json::StreamDecodeStatus::TRADE:
+                    if (tradeHandler && passesFilters(decodedEvent.trade.symbol)) {
+                        emit(decodedEvent.trade, tradeHandler, decodedEvent.trade.symbol);
+                    }
+                    break;
+                case json::StreamDecodeStatus::QUOTE:
+                    if (quoteHandler && passesFilters(decodedEvent.quote.symbol)) {
+                        emit(decodedEvent.quote, quoteHandler, decodedEvent.quote.symbol);
+                    }
+                    break;
+                case json::StreamDecodeStatus::SUMMARY:
+                    if (summaryHandler && passesFilters(decodedEvent.summary.symbol)) {
+                        emit(decodedEvent.summary, summaryHandler, decodedEvent.summary.symbol);
+                    }
+                    break;
+                case json::StreamDecodeStatus::TIMESALE:
+                    if (timesaleHandler && passesFilters(decodedEvent.timesale.symbol)) {
+                        emit(decodedEvent.timesale, timesaleHandler, decodedEvent.timesale.symbol);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        } catch (const std::exception& e) {
+            if (errorHandler) {
+                errorHandler("Event processing error: " + std::string(e.what()));
+            }
+        }
+    }
+    
+    // `compact` also feeds the compact handlers and the market state cache,
+    // for frames the compact decoder declined
+    void processEvent(const nlohmann::json& json, bool compact = false) {
         if (!json.contains("type")) return;
         
         std::string type = json["type"];
@@ -266,6 +836,10 @@ public:
             }
         }
         
+        if (compact) {
+            processCompactEvent(json, type, symbol);
+        }
+        
         try {
             if (type == "trade" && tradeHandler) {
                 TradeEvent event;
@@ -279,7 +853,7 @@ public:
                 event.last = parseNumericField(json, "last", 0.0);
                 
                 event.date = json.value("date", "");
-                tradeHandler(event);
+                emit(event, tradeHandler, symbol);
                 
             } else if (type == "quote" && quoteHandler) {
                 QuoteEvent event;
@@ -295,7 +869,7 @@ public:
                 event.bidDate = json.value("biddate", "");
                 event.askExchange = json.value("askexch", "");
                 event.askDate = json.value("askdate", "");
-                quoteHandler(event);
+                emit(event, quoteHandler, symbol);
                 
             } else if (type == "summary" && summaryHandler) {
                 SummaryEvent event;
@@ -307,7 +881,7 @@ public:
                 event.low = parseNumericField(json, "low", 0.0);
                 event.prevClose = parseNumericField(json, "prevClose", 0.0);
                 
-                summaryHandler(event);
+                emit(event, summaryHandler, symbol);
                 
             } else if (type == "timesale" && timesaleHandler) {
                 TimesaleEvent event;
@@ -326,7 +900,7 @@ public:
                 event.cancel = json.value("cancel", false);
                 event.correction = json.value("correction", false);
                 event.session = json.value("session", "");
-                timesaleHandler(event);
+                emit(event, timesaleHandler, symbol);
             }
             
         } catch (const std::exception& e) {
@@ -336,6 +910,92 @@ public:
         }
     }
     
+    static char parseCodeField(const nlohmann::json& frame, const char* key) {
+        auto it = frame.find(key);
+        if (it == frame.end() || !it->is_string()) {
+            return '\0';
+        }
+        const auto& text = it->get_ref<const std::string&>();
+        return text.empty() ? '\0' : text.front();
+    }
+    
+    static bool parseFlagField(const nlohmann::json& frame, const char* key) {
+        auto it = frame.find(key);
+        return it != frame.end() && it->is_boolean() && it->get<bool>();
+    }
+    
+    static TradingSession parseSessionField(const nlohmann::json& frame) {
+        auto it = frame.find("session");
+        if (it != frame.end() && it->is_string()) {
+            const auto& text = it->get_ref<const std::string&>();
+            if (text == "pre") return TradingSession::PRE;
+            if (text == "normal") return TradingSession::NORMAL;
+            if (text == "post") return TradingSession::POST;
+        }
+        return TradingSession::UNKNOWN;
+    }
+    
+    int64_t parseEpochField(const nlohmann::json& frame, const std::string& key) {
+        return static_cast<int64_t>(parseNumericField(frame, key, 0.0));
+    }
+    
+    // Builds compact events from the DOM with the compact decoder's field
+    // rules, then dispatches them exactly as the fast path would
+    void processCompactEvent(const nlohmann::json& frame, const std::string& type, const std::string& symbol) {
+        auto exch = frame.find("exch");
+        std::string exchange = exch != frame.end() && exch->is_string() ? exch->get<std::string>() : std::string();
+        compactEvent.symbol = symbol;
+        compactEvent.hasExchange = exch != frame.end();
+        compactEvent.exchange = exchange;
+        
+        auto status = json::StreamDecodeStatus::IGNORED;
+        if (type == "trade") {
+            auto& event = compactEvent.trade;
+            event = CompactTradeEvent{};
+            event.symbol = symbolTable->intern(symbol);
+            event.exchange = parseCodeField(frame, "exch");
+            event.price = parseNumericField(frame, "price", 0.0);
+            event.size = static_cast<int32_t>(parseNumericField(frame, "size", 0.0));
+            event.cvol = static_cast<int64_t>(parseNumericField(frame, "cvol", 0.0));
+            event.last = parseNumericField(frame, "last", 0.0);
+            event.timestampMs = parseEpochField(frame, "date");
+            status = json::StreamDecodeStatus::TRADE;
+        } else if (type == "quote") {
+            auto& event = compactEvent.quote;
+            event = CompactQuoteEvent{};
+            event.symbol = symbolTable->intern(symbol);
+            event.bid = parseNumericField(frame, "bid", 0.0);
+            event.ask = parseNumericField(frame, "ask", 0.0);
+            event.bidSize = static_cast<int32_t>(parseNumericField(frame, "bidsz", 0.0));
+            event.askSize = static_cast<int32_t>(parseNumericField(frame, "asksz", 0.0));
+            event.bidExchange = parseCodeField(frame, "bidexch");
+            event.askExchange = parseCodeField(frame, "askexch");
+            event.bidTimeMs = parseEpochField(frame, "biddate");
+            event.askTimeMs = parseEpochField(frame, "askdate");
+            status = json::StreamDecodeStatus::QUOTE;
+        } else if (type == "timesale") {
+            auto& event = compactEvent.timesale;
+            event = CompactTimesaleEvent{};
+            event.symbol = symbolTable->intern(symbol);
+            event.exchange = parseCodeField(frame, "exch");
+            event.bid = parseNumericField(frame, "bid", 0.0);
+            event.ask = parseNumericField(frame, "ask", 0.0);
+            event.last = parseNumericField(frame, "last", 0.0);
+            event.size = static_cast<int32_t>(parseNumericField(frame, "size", 0.0));
+            event.seq = static_cast<int32_t>(parseNumericField(frame, "seq", 0.0));
+            event.timestampMs = parseEpochField(frame, "date");
+            event.flag = parseCodeField(frame, "flag");
+            event.cancel = parseFlagField(frame, "cancel");
+            event.correction = parseFlagField(frame, "correction");
+            event.session = parseSessionField(frame);
+            status = json::StreamDecodeStatus::TIMESALE;
+        }
+        
+        if (status != json::StreamDecodeStatus::IGNORED) {
+            dispatchCompactEvent(status);
+        }
+    }
+    
     void startHeartbeat() {
         tradier::debug::Logger::getInstance().info("StreamingService: Starting heartbeat thread");
         
@@ -418,6 +1078,14 @@ public:
         }
     }
     
+    // QUEUED dispatch and quote conflation; a no-op while a dispatcher runs
+    void startDispatcher() {
+        if (!dispatcher && (config.dispatchMode == DispatchMode::QUEUED || config.conflateQuotes)) {
+            dispatcher = std::make_unique<EventDispatcher>(
+                config, stats, [this](QueuedEvent& event) { deliverEvent(event); });
+        }
+    }
+    
     void disconnect() {
         connected = false;
         threadManager.stop();
@@ -426,6 +1094,8 @@ public:
             connection->disconnect();
             connection.reset();
         }
+        
+        dispatcher.reset();
     }
 };
 
@@ -663,6 +1333,106 @@ bool StreamingService::subscribeToTimesales(
     return false;
 }
 
+bool StreamingService::subscribeMarketEvents(
+    const StreamSession& session,
+    const std::vector<std::string>& symbols,
+    const char* eventType) {
+    
+    {
+        std::lock_guard<std::mutex> lock(impl_->subscriptionMutex);
+        for (const auto& symbol : symbols) {
+            impl_->subscribedSymbols.insert(symbol);
+            impl_->symbolTable->intern(symbol);
+        }
+    }
+    
+    if (!impl_->connected) {
+        connect();
+    }
+    
+    if (impl_->connection) {
+        nlohmann::json subscription;
+        subscription["type"] = "subscribe";
+        subscription["to"] = eventType;
+        subscription["symbols"] = symbols;
+        subscription["sessionid"] = session.sessionId;
+        
+        try {
+            impl_->connection->send(subscription.dump());
+            return true;
+        } catch (const std::exception& e) {
+            if (impl_->errorHandler) {
+                impl_->errorHandler("Subscription error: " + std::string(e.what()));
+            }
+            return false;
+        }
+    }
+    
+    return false;
+}
+
+bool StreamingService::subscribeToTradesCompact(
+    const StreamSession& session,
+    const std::vector<std::string>& symbols,
+    CompactTradeEventHandler handler) {
+    
+    if (!session.isActive || symbols.empty() || !handler) {
+        return false;
+    }
+    
+    impl_->compactTradeHandler = std::move(handler);
+    return subscribeMarketEvents(session, symbols, "trade");
+}
+
+bool StreamingService::subscribeToQuotesCompact(
+    const StreamSession& session,
+    const std::vector<std::string>& symbols,
+    CompactQuoteEventHandler handler) {
+    
+    if (!session.isActive || symbols.empty() || !handler) {
+        return false;
+    }
+    
+    impl_->compactQuoteHandler = std::move(handler);
+    return subscribeMarketEvents(session, symbols, "quote");
+}
+
+bool StreamingService::subscribeToTimesalesCompact(
+    const StreamSession& session,
+    const std::vector<std::string>& symbols,
+    CompactTimesaleEventHandler handler) {
+    
+    if (!session.isActive || symbols.empty() || !handler) {
+        return false;
+    }
+    
+    impl_->compactTimesaleHandler = std::move(handler);
+    return subscribeMarketEvents(session, symbols, "timesale");
+}
+
+const SymbolTable& StreamingService::symbols() const {
+    return *impl_->symbolTable;
+}
+
+void StreamingService::shareSymbolTable(std::shared_ptr<SymbolTable> table) {
+    impl_->symbolTable = std::move(table);
+}
+
+void StreamingService::shareMarketState(std::shared_ptr<MarketStateCache> cache) {
+    impl_->marketState = std::move(cache);
+}
+
+std::shared_ptr<MarketStateCache> StreamingService::enableMarketState() {
+    if (!impl_->marketState) {
+        impl_->marketState = std::make_shared<MarketStateCache>(impl_->symbolTable);
+    }
+    return impl_->marketState;
+}
+
+std::shared_ptr<MarketStateCache> StreamingService::marketState() const {
+    return impl_->marketState;
+}
+
 bool StreamingService::subscribeToOrderEvents(
     const StreamSession& session,
     AccountOrderEventHandler handler) {
@@ -767,8 +1537,10 @@ void StreamingService::connect() {
             wsClient.connect(endpoint, client_.config().accessToken)
         );
         
-        impl_->connection->setMessageHandler([this](const std::string& message) {
-            impl_->handleMessage(message);
+        impl_->startDispatcher();
+        
+        impl_->connection->setMessageHandler([impl = impl_.get()](std::string_view message) {
+            impl->handleMessage(message);
         });
         
         impl_->connection->setAuthToken(client_.config().accessToken);
@@ -790,6 +1562,11 @@ void StreamingService::disconnect() {
     impl_->disconnect();
 }
 
+void StreamingService::processMessage(std::string_view message) {
+    impl_->startDispatcher();
+    impl_->handleMessage(message);
+}
+
 bool StreamingService::isConnected() const {
     return impl_->connected;
 }
@@ -829,12 +1606,12 @@ std::string StreamingService::getConnectionStatus() const {
 
 void StreamingService::setSymbolFilter(const std::vector<std::string>& symbols) {
     std::lock_guard<std::mutex> lock(impl_->subscriptionMutex);
-    impl_->symbolFilter = std::unordered_set<std::string>(symbols.begin(), symbols.end());
+    impl_->symbolFilter = FilterSet(symbols.begin(), symbols.end());
 }
 
 void StreamingService::setExchangeFilter(const std::vector<std::string>& exchanges) {
     std::lock_guard<std::mutex> lock(impl_->subscriptionMutex);
-    impl_->exchangeFilter = std::unordered_set<std::string>(exchanges.begin(), exchanges.end());
+    impl_->exchangeFilter = FilterSet(exchanges.begin(), exchanges.end());
 }
 
 void StreamingService::clearFilters() {
@@ -843,4 +1620,206 @@ void StreamingService::clearFilters() {
     impl_->exchangeFilter.clear();
 }
 
+ShardedStreamingService::ShardedStreamingService(TradierClient& client, size_t shardCount)
+    : symbols_(std::make_shared<SymbolTable>()) {
+    shardCount = std::max<size_t>(shardCount, 1);
+    shards_.reserve(shardCount);
+    for (size_t i = 0; i < shardCount; ++i) {
+        shards_.push_back(std::make_unique<StreamingService>(client));
+        shards_.back()->shareSymbolTable(symbols_);
+    }
+}
+
+ShardedStreamingService::~ShardedStreamingService() {
+    disconnect();
+}
+
+Result<std::vector<StreamSession>> ShardedStreamingService::createMarketSessions() {
+    return tryExecute<std::vector<StreamSession>>([&]() {
+        std::vector<StreamSession> sessions;
+        sessions.reserve(shards_.size());
+        for (auto& shard : shards_) {
+            auto session = shard->createMarketSession();
+            if (!session) {
+                throw session.error();
+            }
+            sessions.push_back(session.value());
+        }
+        sessions_ = sessions;
+        return sessions;
+    }, "createMarketSessions");
+}
+
+size_t ShardedStreamingService::shardCount() const {
+    return shards_.size();
+}
+
+// FNV-1a, so the assignment is stable across processes and platforms
+size_t ShardedStreamingService::shardFor(std::string_view symbol) const {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : symbol) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash % shards_.size());
+}
+
+StreamingService& ShardedStreamingService::shard(size_t index) {
+    return *shards_.at(index);
+}
+
+std::vector<std::vector<std::string>> ShardedStreamingService::partition(const std::vector<std::string>& symbols) const {
+    std::vector<std::vector<std::string>> parts(shards_.size());
+    for (const auto& symbol : symbols) {
+        parts[shardFor(symbol)].push_back(symbol);
+    }
+    return parts;
+}
+
+template<typename Handler>
+bool ShardedStreamingService::subscribeAll(
+    const std::vector<std::string>& symbols,
+    Handler handler,
+    bool (StreamingService::*subscribe)(const StreamSession&, const std::vector<std::string>&, Handler)) {
+    
+    if (sessions_.size() != shards_.size() || symbols.empty() || !handler) {
+        return false;
+    }
+    
+    auto parts = partition(symbols);
+    bool success = true;
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        if (!parts[i].empty()) {
+            success = ((*shards_[i]).*subscribe)(sessions_[i], parts[i], handler) && success;
+        }
+    }
+    return success;
+}
+
+bool ShardedStreamingService::subscribeToTrades(const std::vector<std::string>& symbols, TradeEventHandler handler) {
+    return subscribeAll(symbols, std::move(handler), &StreamingService::subscribeToTrades);
+}
+
+bool ShardedStreamingService::subscribeToQuotes(const std::vector<std::string>& symbols, QuoteEventHandler handler) {
+    return subscribeAll(symbols, std::move(handler), &StreamingService::subscribeToQuotes);
+}
+
+bool ShardedStreamingService::subscribeToSummary(const std::vector<std::string>& symbols, SummaryEventHandler handler) {
+    return subscribeAll(symbols, std::move(handler), &StreamingService::subscribeToSummary);
+}
+
+bool ShardedStreamingService::subscribeToTimesales(const std::vector<std::string>& symbols, TimesaleEventHandler handler) {
+    return subscribeAll(symbols, std::move(handler), &StreamingService::subscribeToTimesales);
+}
+
+bool ShardedStreamingService::subscribeToTradesCompact(const std::vector<std::string>& symbols, CompactTradeEventHandler handler) {
+    return subscribeAll(symbols, std::move(handler), &StreamingService::subscribeToTradesCompact);
+}
+
+bool ShardedStreamingService::subscribeToQuotesCompact(const std::vector<std::string>& symbols, CompactQuoteEventHandler handler) {
+    return subscribeAll(symbols, std::move(handler), &StreamingService::subscribeToQuotesCompact);
+}
+
+bool ShardedStreamingService::subscribeToTimesalesCompact(const std::vector<std::string>& symbols, CompactTimesaleEventHandler handler) {
+    return subscribeAll(symbols, std::move(handler), &StreamingService::subscribeToTimesalesCompact);
+}
+
+const SymbolTable& ShardedStreamingService::symbols() const {
+    return *symbols_;
+}
+
+std::shared_ptr<MarketStateCache> ShardedStreamingService::enableMarketState() {
+    if (!marketState_) {
+        marketState_ = std::make_shared<MarketStateCache>(symbols_);
+        for (auto& shard : shards_) {
+            shard->shareMarketState(marketState_);
+        }
+    }
+    return marketState_;
+}
+
+std::shared_ptr<MarketStateCache> ShardedStreamingService::marketState() const {
+    return marketState_;
+}
+
+void ShardedStreamingService::setConfig(const StreamingConfig& config) {
+    for (auto& shard : shards_) {
+        shard->setConfig(config);
+    }
+}
+
+void ShardedStreamingService::setErrorHandler(ErrorHandler handler) {
+    for (auto& shard : shards_) {
+        shard->setErrorHandler(handler);
+    }
+}
+
+void ShardedStreamingService::connect() {
+    for (auto& shard : shards_) {
+        shard->connect();
+    }
+}
+
+void ShardedStreamingService::disconnect() {
+    for (auto& shard : shards_) {
+        shard->disconnect();
+    }
+}
+
+bool ShardedStreamingService::isConnected() const {
+    return std::all_of(shards_.begin(), shards_.end(),
+                       [](const auto& shard) { return shard->isConnected(); });
+}
+
+StreamStatistics::Snapshot ShardedStreamingService::getStatistics() const {
+    StreamStatistics::Snapshot total{};
+    bool first = true;
+    for (const auto& shard : shards_) {
+        auto stats = shard->getStatistics();
+        total.messagesReceived += stats.messagesReceived;
+        total.messagesProcessed += stats.messagesProcessed;
+        total.errors += stats.errors;
+        total.reconnects += stats.reconnects;
+        total.eventsQueued += stats.eventsQueued;
+        total.eventsDropped += stats.eventsDropped;
+        total.eventsConflated += stats.eventsConflated;
+        total.producerStalls += stats.producerStalls;
+        total.queueHighWater = std::max(total.queueHighWater, stats.queueHighWater);
+        total.quotesConflated += stats.quotesConflated;
+        if (stats.connectionStart != TimePoint{} &&
+            (first || stats.connectionStart < total.connectionStart)) {
+            total.connectionStart = stats.connectionStart;
+            first = false;
+        }
+        total.lastMessage = std::max(total.lastMessage, stats.lastMessage);
+        total.feedLatency.merge(stats.feedLatency);
+        total.dispatchLatency.merge(stats.dispatchLatency);
+    }
+    return total;
+}
+
+void ShardedStreamingService::resetStatistics() {
+    for (auto& shard : shards_) {
+        shard->resetStatistics();
+    }
+}
+
+void ShardedStreamingService::setSymbolFilter(const std::vector<std::string>& symbols) {
+    for (auto& shard : shards_) {
+        shard->setSymbolFilter(symbols);
+    }
+}
+
+void ShardedStreamingService::setExchangeFilter(const std::vector<std::string>& exchanges) {
+    for (auto& shard : shards_) {
+        shard->setExchangeFilter(exchanges);
+    }
+}
+
+void ShardedStreamingService::clearFilters() {
+    for (auto& shard : shards_) {
+        shard->clearFilters();
+    }
+}
+
 }
\ No newline at end of file
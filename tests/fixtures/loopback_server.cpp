@@ -0,0 +1,170 @@
+#include "loopback_server.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <zlib.h>
+#include <cstdlib>
+#include <string_view>
+
+namespace tradier {
+namespace test {
+
+std::string gzip(const std::string& body) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+    std::string out(deflateBound(&stream, body.size()), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(body.data()));
+    stream.avail_in = static_cast<uInt>(body.size());
+    stream.next_out = reinterpret_cast<Bytef*>(out.data());
+    stream.avail_out = static_cast<uInt>(out.size());
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+LoopbackServer::LoopbackServer(Handler handler) : handler_(std::move(handler)) {
+    start();
+}
+
+LoopbackServer::LoopbackServer(const std::string& body, bool compressed) {
+    std::string payload = compressed ? gzip(body) : body;
+    fixedResponse_ = response(200, payload, std::string("Content-Type: application/json\r\n") +
+                                                (compressed ? "Content-Encoding: gzip\r\n" : ""));
+    start();
+}
+
+LoopbackServer::~LoopbackServer() {
+    stopping_ = true;
+    ::shutdown(listenFd_, SHUT_RDWR);
+    ::close(listenFd_);
+    acceptThread_.join();
+
+    std::vector<Connection> open;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open.swap(open_);
+    }
+    // Sockets stay open until here so a descriptor is never reused while
+    // its connection thread may still touch it
+    for (auto& connection : open) {
+        ::shutdown(connection.fd, SHUT_RDWR);
+        connection.thread.join();
+        ::close(connection.fd);
+    }
+}
+
+std::string LoopbackServer::response(int status, const std::string& body, const std::string& headers) {
+    const char* reason = status == 200 ? "OK" : status == 304 ? "Not Modified" : "Status";
+    return "HTTP/1.1 " + std::to_string(status) + " " + reason + "\r\n" + headers +
+           "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+}
+
+std::string LoopbackServer::baseUrl() const {
+    return "http://127.0.0.1:" + std::to_string(port_) + "/v1";
+}
+
+Config LoopbackServer::config() const {
+    Config config;
+    config.accessToken = "test-token";
+    config.baseUrlOverride = baseUrl();
+    config.timeoutSeconds = 5;
+    return config;
+}
+
+LoopbackServer::Request LoopbackServer::lastRequest() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastRequest_;
+}
+
+void LoopbackServer::start() {
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    int enable = 1;
+    ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    ::listen(listenFd_, 128);
+
+    socklen_t length = sizeof(address);
+    ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+
+    acceptThread_ = std::thread([this]() {
+        while (!stopping_) {
+            int fd = ::accept(listenFd_, nullptr, nullptr);
+            if (fd < 0) {
+                break;
+            }
+            connections_++;
+            std::lock_guard<std::mutex> lock(mutex_);
+            open_.push_back({fd, std::thread([this, fd]() { serve(fd); })});
+        }
+    });
+}
+
+void LoopbackServer::serve(int fd) {
+    std::string buffer;
+    char chunk[4096];
+    while (!stopping_) {
+        auto headEnd = buffer.find("\r\n\r\n");
+        size_t bodyLength = 0;
+        if (headEnd != std::string::npos) {
+            auto header = buffer.find("Content-Length: ");
+            if (header != std::string::npos && header < headEnd) {
+                bodyLength = std::strtoul(buffer.c_str() + header + 16, nullptr, 10);
+            }
+        }
+        if (headEnd == std::string::npos || buffer.size() < headEnd + 4 + bodyLength) {
+            ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                break;
+            }
+            buffer.append(chunk, static_cast<size_t>(received));
+            continue;
+        }
+
+        Request request;
+        request.head = buffer.substr(0, headEnd);
+        request.body = buffer.substr(headEnd + 4, bodyLength);
+        buffer.erase(0, headEnd + 4 + bodyLength);
+        auto methodEnd = request.head.find(' ');
+        auto targetEnd = request.head.find(' ', methodEnd + 1);
+        request.method = request.head.substr(0, methodEnd);
+        request.target = request.head.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+
+        int inFlight = ++inFlight_;
+        int seen = maxInFlight_;
+        while (inFlight > seen && !maxInFlight_.compare_exchange_weak(seen, inFlight)) {
+        }
+
+        std::string handled;
+        const std::string* response = &fixedResponse_;
+        if (handler_) {
+            handled = handler_(request);
+            response = &handled;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            lastRequest_ = std::move(request);
+        }
+        requests_++;
+        inFlight_--;
+
+        if (::send(fd, response->data(), response->size(), MSG_NOSIGNAL) < 0) {
+            break;
+        }
+        std::string_view responseHead(response->data(), response->find("\r\n\r\n"));
+        if (responseHead.find("Connection: close") != std::string_view::npos) {
+            break;
+        }
+    }
+    ::shutdown(fd, SHUT_RDWR);
+}
+
+} // namespace test
+} // namespace tradier
\ No newline at end of file
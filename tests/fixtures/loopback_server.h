@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tradier/common/config.hpp"
+
+namespace tradier {
+namespace test {
+
+// gzip-encodes a body the way a server would for Content-Encoding: gzip
+std::string gzip(const std::string& body);
+
+/**
+ * Minimal HTTP/1.1 server on loopback for tests and benchmarks, so they
+ * exercise the client rather than a network. Every connection is served on
+ * its own thread and kept alive until the client closes it or a response
+ * carries "Connection: close".
+ */
+class LoopbackServer {
+public:
+    struct Request {
+        std::string method;
+        std::string target;
+        std::string head;
+        std::string body;
+        
+        // Case-sensitive search of the request line and headers
+        bool contains(const std::string& text) const {
+            return head.find(text) != std::string::npos;
+        }
+    };
+    
+    // Returns the raw response, see response()
+    using Handler = std::function<std::string(const Request&)>;
+    
+    explicit LoopbackServer(Handler handler);
+    
+    // Answers every request with one fixed 200 body; with `compressed` it is
+    // sent gzip-encoded whatever the client asked for
+    explicit LoopbackServer(const std::string& body, bool compressed = false);
+    
+    ~LoopbackServer();
+    
+    LoopbackServer(const LoopbackServer&) = delete;
+    LoopbackServer& operator=(const LoopbackServer&) = delete;
+    
+    static std::string response(int status, const std::string& body, const std::string& headers = "");
+    
+    std::string baseUrl() const;
+    
+    // A client configuration pointed at this server
+    Config config() const;
+    
+    int requests() const { return requests_; }
+    int connections() const { return connections_; }
+    
+    // Most requests being handled at the same moment
+    int maxInFlight() const { return maxInFlight_; }
+    
+    Request lastRequest() const;
+
+private:
+    struct Connection {
+        int fd;
+        std::thread thread;
+    };
+    
+    int listenFd_ = -1;
+    uint16_t port_ = 0;
+    Handler handler_;
+    std::string fixedResponse_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<int> requests_{0};
+    std::atomic<int> connections_{0};
+    std::atomic<int> inFlight_{0};
+    std::atomic<int> maxInFlight_{0};
+    std::thread acceptThread_;
+    mutable std::mutex mutex_;
+    std::vector<Connection> open_;
+    Request lastRequest_;
+    
+    void start();
+    void serve(int fd);
+};
+
+} // namespace test
+} // namespace tradier
\ No newline at end of file
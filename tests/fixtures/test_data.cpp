@@ -353,49 +353,40 @@ std::vector<std::map<std::string, std::string>> TestData::get_invalid_orders() {
 
 // ConfigBuilder implementations
 ConfigBuilder::ConfigBuilder() {
-    config_.base_url = "https://api.tradier.com";
-    config_.sandbox = false;
-    config_.debug_logging = false;
-    config_.rate_limit_requests_per_second = 10;
-    config_.timeout_seconds = 30;
-    config_.max_retry_attempts = 3;
+    config_.sandboxMode = false;
+    config_.timeoutSeconds = 30;
 }
 
 ConfigBuilder& ConfigBuilder::with_base_url(const std::string& url) {
-    config_.base_url = url;
+    config_.baseUrlOverride = url;
     return *this;
 }
 
 ConfigBuilder& ConfigBuilder::with_access_token(const std::string& token) {
-    config_.access_token = token;
+    config_.accessToken = token;
     return *this;
 }
 
 ConfigBuilder& ConfigBuilder::with_sandbox(bool enabled) {
-    config_.sandbox = enabled;
-    if (enabled) {
-        config_.base_url = "https://sandbox.tradier.com";
-    }
+    config_.sandboxMode = enabled;
     return *this;
 }
 
-ConfigBuilder& ConfigBuilder::with_rate_limit(int requests_per_second) {
-    config_.rate_limit_requests_per_second = requests_per_second;
+// Config has no rate limit, retry or logging knobs; kept for source compatibility
+ConfigBuilder& ConfigBuilder::with_rate_limit(int /* requests_per_second */) {
     return *this;
 }
 
 ConfigBuilder& ConfigBuilder::with_timeout(int timeout_seconds) {
-    config_.timeout_seconds = timeout_seconds;
+    config_.timeoutSeconds = timeout_seconds;
     return *this;
 }
 
-ConfigBuilder& ConfigBuilder::with_retry_count(int retries) {
-    config_.max_retry_attempts = retries;
+ConfigBuilder& ConfigBuilder::with_retry_count(int /* retries */) {
     return *this;
 }
 
-ConfigBuilder& ConfigBuilder::with_debug_logging(bool enabled) {
-    config_.debug_logging = enabled;
+ConfigBuilder& ConfigBuilder::with_debug_logging(bool /* enabled */) {
     return *this;
 }
 
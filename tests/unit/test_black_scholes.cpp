@@ -0,0 +1,181 @@
+#include <catch2/catch_test_macros.hpp>
+#include "tradier/market.hpp"
+#include "tradier/pricing.hpp"
+#include "tradier/simd/black_scholes.hpp"
+#include "tradier/streaming.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace tradier;
+namespace pricing = tradier::simd::pricing;
+
+namespace {
+
+bool near(double a, double b, double tolerance) {
+    return std::fabs(a - b) <= tolerance * std::max(1.0, std::fabs(b));
+}
+
+struct Grid {
+    std::vector<double> strike, expiry, vol;
+    std::vector<OptionRight> right;
+    
+    explicit Grid(size_t rows) {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<double> moneyness(0.6, 1.5);
+        std::uniform_real_distribution<double> years(0.002, 2.0);
+        std::uniform_real_distribution<double> sigma(0.05, 1.2);
+        for (size_t i = 0; i < rows; ++i) {
+            strike.push_back(450.0 * moneyness(rng));
+            expiry.push_back(years(rng));
+            vol.push_back(sigma(rng));
+            right.push_back(i % 2 ? OptionRight::PUT : OptionRight::CALL);
+        }
+    }
+    
+    pricing::contracts contracts() const {
+        return {strike.data(), expiry.data(), right.data(), strike.size()};
+    }
+};
+
+}
+
+TEST_CASE("Black-Scholes - Reference values", "[simd][pricing]") {
+    double strike[] = {100.0, 100.0};
+    double expiry[] = {1.0, 1.0};
+    double vol[] = {0.2, 0.2};
+    OptionRight right[] = {OptionRight::CALL, OptionRight::PUT};
+    pricing::contracts rows{strike, expiry, right, 2};
+    
+    double price[2], delta[2];
+    pricing::outputs out;
+    out.price = price;
+    out.delta = delta;
+    
+    SECTION("Spot model") {
+        pricing::market mkt{pricing::model::black_scholes, 100.0, 0.05, 0.0};
+        pricing::price(mkt, rows, vol, out);
+        REQUIRE(near(price[0], 10.450583572185565, 1e-13));
+        REQUIRE(near(price[1], 5.573526022256971, 1e-13));
+        REQUIRE(near(delta[0], 0.6368306511756191, 1e-13));
+        REQUIRE(near(delta[0] - delta[1], 1.0, 1e-13));
+    }
+    
+    SECTION("Forward model") {
+        pricing::market mkt{pricing::model::black76, 100.0, 0.05, 0.0};
+        pricing::price(mkt, rows, vol, out);
+        REQUIRE(near(price[0], 7.57708214642728, 1e-13));
+        REQUIRE(near(price[0], price[1], 1e-13));
+    }
+    
+    SECTION("Expired and unpriceable rows") {
+        pricing::market mkt{pricing::model::black_scholes, 110.0, 0.0, 0.0};
+        double zero[] = {0.0, 0.0};
+        pricing::price(mkt, {strike, zero, right, 2}, vol, out);
+        REQUIRE(price[0] == 10.0);
+        REQUIRE(price[1] == 0.0);
+        REQUIRE(delta[0] == 1.0);
+        
+        double quoted[] = {9.0, 0.0};    // below intrinsic, and nothing to solve
+        double implied[2];
+        REQUIRE(pricing::implied_volatility(mkt, rows, quoted, implied) == 0);
+        REQUIRE(std::isnan(implied[0]));
+        REQUIRE(std::isnan(implied[1]));
+    }
+}
+
+TEST_CASE("Black-Scholes - Every supported variant matches scalar", "[simd][pricing]") {
+    Grid grid(1037);
+    auto rows = grid.contracts();
+    size_t count = rows.count;
+    pricing::market mkt{pricing::model::black_scholes, 450.0, 0.045, 0.013};
+    
+    std::vector<double> price(count), delta(count), gamma(count), theta(count), vega(count), rho(count);
+    pricing::outputs reference{price.data(), delta.data(), gamma.data(), theta.data(), vega.data(), rho.data()};
+    pricing::price_impl::scalar(mkt, rows, grid.vol.data(), reference);
+    
+    std::vector<double> referenceIv(count);
+    size_t referenceConverged = pricing::implied_volatility_impl::scalar(mkt, rows, price.data(), referenceIv.data(), {});
+    REQUIRE(referenceConverged > count * 9 / 10);
+    
+    simd::isa initial = simd::active_isa();
+    for (simd::isa variant : {simd::isa::scalar, simd::isa::avx2, simd::isa::avx512}) {
+        if (simd::select_isa(variant) != variant) {
+            continue;
+        }
+        INFO("variant " << simd::isa_name(variant));
+        
+        std::vector<double> fast(6 * count);
+        pricing::outputs out{&fast[0], &fast[count], &fast[2 * count], &fast[3 * count], &fast[4 * count], &fast[5 * count]};
+        pricing::price(mkt, rows, grid.vol.data(), out);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(near(out.price[i], price[i], 1e-12));
+            REQUIRE(near(out.delta[i], delta[i], 1e-12));
+            REQUIRE(near(out.gamma[i], gamma[i], 1e-12));
+            REQUIRE(near(out.theta[i], theta[i], 1e-12));
+            REQUIRE(near(out.vega[i], vega[i], 1e-12));
+            REQUIRE(near(out.rho[i], rho[i], 1e-12));
+        }
+        
+        std::vector<double> iv(count);
+        size_t converged = pricing::implied_volatility(mkt, rows, price.data(), iv.data());
+        REQUIRE(converged == referenceConverged);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(std::isnan(iv[i]) == std::isnan(referenceIv[i]));
+            // Far out of the money the price tolerance admits a wide range of vols
+            if (!std::isnan(iv[i]) && vega[i] > 1e-3) {
+                REQUIRE(near(iv[i], grid.vol[i], 1e-5));
+            }
+        }
+    }
+    simd::select_isa(initial);
+}
+
+TEST_CASE("Option Chain Pricer - Quotes drive implied volatility and greeks", "[simd][pricing]") {
+    std::vector<OptionChain> chain(3);
+    double strikes[] = {440.0, 450.0, 460.0};
+    for (size_t i = 0; i < chain.size(); ++i) {
+        chain[i].symbol = "SPY250117C00" + std::to_string(static_cast<int>(strikes[i])) + "000";
+        chain[i].underlying = "SPY";
+        chain[i].strike = strikes[i];
+        chain[i].optionType = "call";
+    }
+    
+    OptionChainPricer pricer(chain, 0.25, {pricing::model::black_scholes, 0.04, 0.0});
+    REQUIRE(pricer.refresh() == 0);
+    
+    // Quote each contract at its 20% vol price
+    double expiry[] = {0.25, 0.25, 0.25};
+    double vol[] = {0.2, 0.2, 0.2};
+    OptionRight right[] = {OptionRight::CALL, OptionRight::CALL, OptionRight::CALL};
+    double fair[3];
+    pricing::outputs out;
+    out.price = fair;
+    pricing::price({pricing::model::black_scholes, 450.0, 0.04, 0.0}, {strikes, expiry, right, 3}, vol, out);
+    
+    QuoteEvent quote;
+    quote.symbol = "SPY";
+    quote.bid = 449.99;
+    quote.ask = 450.01;
+    REQUIRE(pricer.applyQuote(quote));
+    for (size_t i = 0; i < 2; ++i) {
+        quote.symbol = chain[i].symbol;
+        quote.bid = fair[i] - 0.05;
+        quote.ask = fair[i] + 0.05;
+        REQUIRE(pricer.applyQuote(quote));
+    }
+    quote.symbol = "QQQ";
+    REQUIRE_FALSE(pricer.applyQuote(quote));
+    
+    REQUIRE(pricer.refresh() == 2);
+    const auto& columns = pricer.chain();
+    REQUIRE(pricer.underlyingPrice() == 450.0);
+    REQUIRE(near(columns.midIv[0], 0.2, 1e-6));
+    REQUIRE(near(columns.midIv[1], 0.2, 1e-6));
+    REQUIRE(columns.valid(1, OptionChainColumns::HAS_GREEKS));
+    REQUIRE(columns.delta[1] > 0.5);
+    REQUIRE(columns.delta[1] < 0.6);
+    REQUIRE(std::isnan(columns.midIv[2]));    // never quoted
+    REQUIRE_FALSE(columns.valid(2, OptionChainColumns::HAS_GREEKS));
+}
@@ -0,0 +1,152 @@
+#include <catch2/catch_test_macros.hpp>
+#include "tradier/market.hpp"
+#include "tradier/simd/chain_analytics.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace tradier;
+namespace chain = tradier::simd::chain;
+
+namespace {
+
+// Odd row count so every vector width leaves a scalar tail
+OptionChainColumns makeChain(size_t rows) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> price(0.0, 25.0);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::uniform_int_distribution<int32_t> interest(0, 50000);
+    
+    OptionChainColumns columns;
+    for (size_t i = 0; i < rows; ++i) {
+        double bid = price(rng);
+        columns.strike.push_back(300.0 + static_cast<double>(i % 200) * 2.5);
+        columns.bid.push_back(i % 17 == 0 ? 0.0 : bid);
+        columns.ask.push_back(i % 17 == 0 ? 0.0 : bid + price(rng) * 0.05);
+        columns.delta.push_back(unit(rng));
+        columns.gamma.push_back(std::fabs(unit(rng)) * 0.05);
+        columns.openInterest.push_back(interest(rng));
+        columns.contractSize.push_back(i % 50 == 0 ? 10 : 100);
+    }
+    columns.delta[3] = 0.25;
+    columns.delta[4] = -0.35;
+    columns.ask[5] = std::numeric_limits<double>::quiet_NaN();
+    return columns;
+}
+
+bool sameValue(double a, double b) {
+    return (std::isnan(a) && std::isnan(b)) || a == b;
+}
+
+bool close(double a, double b) {
+    return std::fabs(a - b) <= 1e-9 * std::max(1.0, std::fabs(b));
+}
+
+}
+
+TEST_CASE("Chain Analytics - Element-wise kernels match scalar", "[simd][market]") {
+    auto columns = makeChain(1037);
+    size_t rows = columns.size();
+    std::vector<double> fast(rows), reference(rows);
+    
+    SECTION("Mid price") {
+        chain::mid_price(columns, fast.data());
+        chain::mid_price_impl::scalar(columns.bid.data(), columns.ask.data(), reference.data(), rows);
+        for (size_t i = 0; i < rows; ++i) REQUIRE(sameValue(fast[i], reference[i]));
+        REQUIRE(fast[1] == (columns.bid[1] + columns.ask[1]) / 2);
+    }
+    
+    SECTION("Relative spread") {
+        chain::relative_spread(columns, fast.data());
+        chain::relative_spread_impl::scalar(columns.bid.data(), columns.ask.data(), reference.data(), rows);
+        for (size_t i = 0; i < rows; ++i) REQUIRE(sameValue(fast[i], reference[i]));
+        REQUIRE(std::isnan(fast[0]));
+        REQUIRE(std::isnan(fast[5]));
+    }
+    
+    SECTION("Moneyness") {
+        chain::moneyness(columns, 450.0, fast.data());
+        chain::moneyness_impl::scalar(columns.strike.data(), 450.0, reference.data(), rows);
+        for (size_t i = 0; i < rows; ++i) REQUIRE(sameValue(fast[i], reference[i]));
+        REQUIRE(fast[60] == 1.0);
+    }
+}
+
+TEST_CASE("Chain Analytics - Aggregates and masks match scalar", "[simd][market]") {
+    auto columns = makeChain(1037);
+    size_t rows = columns.size();
+    
+    SECTION("Greek exposure") {
+        auto fast = chain::greek_exposure_sum(columns, 450.0);
+        auto reference = chain::greek_exposure_impl::scalar(columns.delta.data(), columns.gamma.data(),
+            columns.openInterest.data(), columns.contractSize.data(), 450.0, rows);
+        REQUIRE(close(fast.dollar_delta, reference.dollar_delta));
+        REQUIRE(close(fast.dollar_gamma, reference.dollar_gamma));
+        
+        double delta = 0.0;
+        for (size_t i = 0; i < rows; ++i) {
+            delta += columns.delta[i] * columns.openInterest[i] * columns.contractSize[i];
+        }
+        REQUIRE(close(fast.dollar_delta, delta * 450.0));
+    }
+    
+    SECTION("Strike range and delta band") {
+        std::vector<uint8_t> fast(rows, 7), reference(rows, 7);
+        
+        size_t selected = chain::strike_range_mask(columns, 400.0, 500.0, fast.data());
+        REQUIRE(selected == chain::range_mask_impl::scalar(columns.strike.data(), 400.0, 500.0, reference.data(), rows));
+        REQUIRE(std::memcmp(fast.data(), reference.data(), rows) == 0);
+        REQUIRE(fast[40] == 1);   // strike 400.0, inclusive bound
+        REQUIRE(fast[0] == 0);
+        
+        selected = chain::delta_band_mask(columns, 0.25, 0.35, fast.data());
+        REQUIRE(selected == chain::abs_range_mask_impl::scalar(columns.delta.data(), 0.25, 0.35, reference.data(), rows));
+        REQUIRE(std::memcmp(fast.data(), reference.data(), rows) == 0);
+        REQUIRE(fast[3] == 1);
+        REQUIRE(fast[4] == 1);
+    }
+    
+    SECTION("Empty input") {
+        REQUIRE(chain::range_mask(nullptr, 0.0, 1.0, nullptr, 0) == 0);
+        REQUIRE(chain::greek_exposure_sum(OptionChainColumns{}, 100.0).dollar_delta == 0.0);
+    }
+}
+
+TEST_CASE("Chain Analytics - Runtime variant selection", "[simd][market]") {
+    auto columns = makeChain(1037);
+    size_t rows = columns.size();
+    simd::isa best = simd::detected_isa();
+    simd::isa initial = simd::active_isa();
+    
+    REQUIRE(static_cast<int>(initial) <= static_cast<int>(best));
+    
+    for (simd::isa variant : {simd::isa::scalar, simd::isa::avx2, simd::isa::avx512}) {
+        simd::isa selected = simd::select_isa(variant);
+        REQUIRE(static_cast<int>(selected) <= static_cast<int>(best));
+        REQUIRE(simd::active_isa() == selected);
+        if (selected != variant) {
+            continue;
+        }
+        
+        INFO("variant " << simd::isa_name(variant));
+        std::vector<double> fast(rows), reference(rows);
+        chain::relative_spread(columns, fast.data());
+        chain::relative_spread_impl::scalar(columns.bid.data(), columns.ask.data(), reference.data(), rows);
+        for (size_t i = 0; i < rows; ++i) REQUIRE(sameValue(fast[i], reference[i]));
+        
+        std::vector<uint8_t> mask(rows), referenceMask(rows);
+        REQUIRE(chain::delta_band_mask(columns, 0.25, 0.35, mask.data()) ==
+                chain::abs_range_mask_impl::scalar(columns.delta.data(), 0.25, 0.35, referenceMask.data(), rows));
+        REQUIRE(mask == referenceMask);
+        
+        auto exposure = chain::greek_exposure_sum(columns, 450.0);
+        auto referenceExposure = chain::greek_exposure_impl::scalar(columns.delta.data(), columns.gamma.data(),
+            columns.openInterest.data(), columns.contractSize.data(), 450.0, rows);
+        REQUIRE(close(exposure.dollar_gamma, referenceExposure.dollar_gamma));
+    }
+    
+    simd::select_isa(initial);
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tradier/common/event_ring.hpp"
+
+using namespace tradier;
+
+TEST_CASE("EventRing - Bounded FIFO", "[streaming][ring]") {
+    EventRing<std::string> ring(3);
+    REQUIRE(ring.capacity() == 4);
+    
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(ring.tryPush([i](std::string& slot) { slot = "event-" + std::to_string(i); }));
+    }
+    REQUIRE_FALSE(ring.tryPush([](std::string& slot) { slot = "overflow"; }));
+    REQUIRE(ring.size() == 4);
+    
+    std::string out;
+    REQUIRE(ring.tryPop([&out](std::string& slot) { out.swap(slot); }));
+    REQUIRE(out == "event-0");
+    REQUIRE(ring.tryPush([](std::string& slot) { slot = "event-4"; }));
+    
+    std::vector<std::string> drained;
+    while (ring.tryPop([&drained](std::string& slot) { drained.push_back(slot); })) {}
+    REQUIRE(drained == std::vector<std::string>{"event-1", "event-2", "event-3", "event-4"});
+    REQUIRE_FALSE(ring.tryPop([](std::string&) {}));
+}
+
+TEST_CASE("EventRing - Single producer, multiple consumers", "[streaming][ring]") {
+    constexpr long COUNT = 200000;
+    EventRing<long> ring(64);
+    std::atomic<long> sum{0};
+    std::atomic<long> popped{0};
+    
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 3; ++i) {
+        consumers.emplace_back([&]() {
+            while (popped.load() < COUNT) {
+                long value = 0;
+                if (ring.tryPop([&value](long& slot) { value = slot; })) {
+                    sum += value;
+                    popped++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    
+    for (long i = 1; i <= COUNT; ++i) {
+        while (!ring.tryPush([i](long& slot) { slot = i; })) {
+            std::this_thread::yield();
+        }
+    }
+    
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+    REQUIRE(popped.load() == COUNT);
+    REQUIRE(sum.load() == COUNT * (COUNT + 1) / 2);
+}
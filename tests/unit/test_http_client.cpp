@@ -0,0 +1,208 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "fixtures/loopback_server.h"
+#include "tradier/common/errors.hpp"
+#include "tradier/common/http_client.hpp"
+
+using namespace tradier;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Holds every request long enough for concurrent callers to pile up
+std::string slowQuote(const test::LoopbackServer::Request&) {
+    std::this_thread::sleep_for(50ms);
+    return test::LoopbackServer::response(200, R"({"quotes":{}})");
+}
+
+// Echoes the request line and body
+std::string echo(const test::LoopbackServer::Request& request) {
+    return test::LoopbackServer::response(200, request.method + " " + request.target + "\n" + request.body);
+}
+
+}
+
+TEST_CASE("HttpClient - Blocking requests share a bounded handle pool", "[httpclient]") {
+    test::LoopbackServer server(slowQuote);
+    auto config = server.config();
+    config.maxConnections = 2;
+    HttpClient client(config);
+    
+    std::vector<std::thread> callers;
+    std::vector<int> statuses(6, 0);
+    for (size_t i = 0; i < statuses.size(); ++i) {
+        callers.emplace_back([&client, &statuses, i]() { statuses[i] = client.get("/markets/quotes").status; });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    
+    for (int status : statuses) {
+        REQUIRE(status == 200);
+    }
+    REQUIRE(server.requests() == 6);
+    REQUIRE(server.maxInFlight() <= 2);
+    REQUIRE(server.connections() <= 2);
+    
+    auto stats = client.getStatistics();
+    REQUIRE(stats.poolWaits > 0);
+    REQUIRE(stats.connectionsOpened <= 2);
+    
+    client.resetStatistics();
+    REQUIRE(client.get("/markets/quotes").status == 200);
+    REQUIRE(client.getStatistics().poolWaits == 0);
+    REQUIRE(server.connections() <= 2);
+}
+
+TEST_CASE("HttpClient - Async requests complete on the engine thread", "[httpclient][async]") {
+    test::LoopbackServer server(echo);
+    HttpClient client(server.config());
+    
+    auto response = client.getAsync("/markets/quotes", {{"symbols", "SPY"}}).get();
+    REQUIRE(response.status == 200);
+    REQUIRE(response.body == "GET /v1/markets/quotes?symbols=SPY\n");
+    
+    // Assertions stay on the test thread; handlers only hand results back
+    std::promise<std::pair<Response, std::thread::id>> posted;
+    client.postAsync("/accounts/VA000001/orders", {{"class", "equity"}, {"symbol", "SPY"}},
+        [&posted](Response&& response, std::exception_ptr error) {
+            if (error) {
+                posted.set_exception(error);
+            } else {
+                posted.set_value({std::move(response), std::this_thread::get_id()});
+            }
+        });
+    auto [postResponse, handlerThread] = posted.get_future().get();
+    REQUIRE(postResponse.status == 200);
+    REQUIRE(postResponse.body == "POST /v1/accounts/VA000001/orders\nclass=equity&symbol=SPY");
+    REQUIRE(handlerThread != std::this_thread::get_id());
+    
+    auto stats = client.getStatistics();
+    REQUIRE(stats.totalRequests == 2);
+    REQUIRE(stats.successfulRequests == 2);
+}
+
+TEST_CASE("HttpClient - Async bursts beyond the connection limit do not stall", "[httpclient][async]") {
+    test::LoopbackServer server(echo);
+    auto config = server.config();
+    config.maxConnections = 2;
+    HttpClient client(config);
+    
+    auto started = std::chrono::steady_clock::now();
+    for (int round = 0; round < 10; ++round) {
+        std::vector<std::future<Response>> pending;
+        for (int i = 0; i < 32; ++i) {
+            pending.push_back(client.getAsync("/markets/quotes"));
+        }
+        for (auto& future : pending) {
+            REQUIRE(future.get().status == 200);
+        }
+    }
+    
+    // A transfer left waiting inside curl used to sit out the 1s poll timeout
+    REQUIRE(std::chrono::steady_clock::now() - started < 900ms);
+    REQUIRE(server.connections() <= 2);
+}
+
+TEST_CASE("HttpClient - Async retries wait on the timer heap", "[httpclient][async]") {
+    std::atomic<int> calls{0};
+    test::LoopbackServer server([&calls](const test::LoopbackServer::Request&) {
+        if (calls++ < 2) {
+            return test::LoopbackServer::response(503, "busy");
+        }
+        return test::LoopbackServer::response(200, "ok");
+    });
+    HttpClient client(server.config());
+    client.setRetryPolicy(3, 30ms);
+    client.enableRetries();
+    
+    auto started = std::chrono::steady_clock::now();
+    auto future = client.getAsync("/markets/quotes");
+    REQUIRE(std::chrono::steady_clock::now() - started < 30ms);
+    
+    auto response = future.get();
+    REQUIRE(response.status == 200);
+    REQUIRE(response.body == "ok");
+    REQUIRE(std::chrono::steady_clock::now() - started >= 90ms);
+    REQUIRE(server.requests() == 3);
+    
+    auto stats = client.getStatistics();
+    REQUIRE(stats.totalRequests == 1);
+    REQUIRE(stats.retriedRequests == 2);
+    REQUIRE(stats.successfulRequests == 1);
+}
+
+TEST_CASE("HttpClient - Throwing async handlers do not stop the engine", "[httpclient][async]") {
+    test::LoopbackServer server(echo);
+    HttpClient client(server.config());
+    
+    std::promise<void> thrown;
+    client.getAsync("/markets/quotes", {}, [&thrown](Response&&, std::exception_ptr) {
+        thrown.set_value();
+        throw std::runtime_error("handler failure");
+    });
+    thrown.get_future().get();
+    
+    REQUIRE(client.getAsync("/markets/quotes").get().status == 200);
+    REQUIRE(server.requests() == 2);
+}
+
+TEST_CASE("HttpClient - Async transport failures reach the handler", "[httpclient][async]") {
+    Config config;
+    config.accessToken = "test-token";
+    config.baseUrlOverride = "http://127.0.0.1:1/v1";
+    config.timeoutSeconds = 2;
+    HttpClient client(config);
+    
+    std::promise<std::pair<int, std::exception_ptr>> failed;
+    client.getAsync("/markets/quotes", {}, [&failed](Response&& response, std::exception_ptr error) {
+        failed.set_value({response.status, error});
+    });
+    
+    auto [status, error] = failed.get_future().get();
+    REQUIRE(status == 0);
+    REQUIRE(error);
+    REQUIRE_THROWS_AS(std::rethrow_exception(error), ConnectionError);
+    REQUIRE_THROWS_AS(client.getAsync("/markets/quotes").get(), ConnectionError);
+    REQUIRE(client.getStatistics().failedRequests == 2);
+}
+
+TEST_CASE("HttpClient - HTTP/2 mode falls back to HTTP/1.1 servers", "[httpclient][http2]") {
+    test::LoopbackServer server(echo);
+    auto config = server.config();
+    config.http2 = true;
+    config.maxConnections = 2;
+    config.maxConcurrentStreams = 4;
+    HttpClient client(config);
+    
+    auto response = client.get("/markets/quotes", {{"symbols", "SPY"}});
+    REQUIRE(response.status == 200);
+    REQUIRE(response.body == "GET /v1/markets/quotes?symbols=SPY\n");
+    
+    // Bursts beyond maxConnections * maxConcurrentStreams, all over HTTP/1.1
+    // connections that cannot multiplex
+    auto started = std::chrono::steady_clock::now();
+    for (int round = 0; round < 10; ++round) {
+        std::vector<std::future<Response>> pending;
+        for (int i = 0; i < 32; ++i) {
+            pending.push_back(client.postAsync("/accounts/VA000001/orders", {{"symbol", "SPY"}}));
+        }
+        for (auto& future : pending) {
+            auto posted = future.get();
+            REQUIRE(posted.status == 200);
+            REQUIRE(posted.body == "POST /v1/accounts/VA000001/orders\nsymbol=SPY");
+        }
+    }
+    REQUIRE(std::chrono::steady_clock::now() - started < 900ms);
+    
+    auto stats = client.getStatistics();
+    REQUIRE(stats.successfulRequests == 321);
+    REQUIRE(stats.http2Responses == 0);
+    REQUIRE(server.lastRequest().contains("HTTP/1.1"));
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tradier/client.hpp"
+#include "tradier/common/latency_histogram.hpp"
+#include "tradier/streaming.hpp"
+
+using namespace tradier;
+
+TEST_CASE("LatencyHistogram - Buckets and percentiles", "[streaming][histogram]") {
+    for (uint64_t value : {0ull, 1ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, (1ull << 40) - 1}) {
+        size_t bucket = LatencyHistogram::bucketFor(value);
+        REQUIRE(bucket < LatencyHistogram::BUCKETS);
+        REQUIRE(LatencyHistogram::bucketLimit(bucket) >= value);
+        REQUIRE(LatencyHistogram::bucketLimit(bucket) - value <= value / 16);
+    }
+    REQUIRE(LatencyHistogram::bucketFor(1ull << 50) == LatencyHistogram::BUCKETS - 1);
+    
+    LatencyHistogram histogram;
+    REQUIRE(histogram.snapshot().count == 0);
+    REQUIRE(histogram.snapshot().percentile(50) == 0);
+    
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value * 1000);
+    }
+    auto snapshot = histogram.snapshot();
+    REQUIRE(snapshot.count == 1000);
+    REQUIRE(snapshot.min == 1000);
+    REQUIRE(snapshot.max == 1000000);
+    REQUIRE(snapshot.mean() == 500500.0);
+    REQUIRE(snapshot.percentile(50) >= 500000);
+    REQUIRE(snapshot.percentile(50) <= 500000 + 500000 / 16);
+    REQUIRE(snapshot.percentile(99) >= 990000);
+    REQUIRE(snapshot.percentile(100) == 1000000);
+    
+    LatencyHistogram other;
+    other.record(5);
+    auto merged = other.snapshot();
+    merged.merge(snapshot);
+    REQUIRE(merged.count == 1001);
+    REQUIRE(merged.min == 5);
+    REQUIRE(merged.max == 1000000);
+    
+    LatencyHistogram copy(histogram);
+    REQUIRE(copy.snapshot().count == 1000);
+    histogram.reset();
+    REQUIRE(histogram.snapshot().count == 0);
+    REQUIRE(copy.snapshot().count == 1000);
+}
+
+TEST_CASE("LatencyHistogram - Concurrent recording", "[streaming][histogram]") {
+    LatencyHistogram histogram;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&histogram, t]() {
+            for (uint64_t i = 0; i < 50000; ++i) {
+                histogram.record(i + static_cast<uint64_t>(t));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    
+    auto snapshot = histogram.snapshot();
+    REQUIRE(snapshot.count == 200000);
+    REQUIRE(snapshot.min == 0);
+    REQUIRE(snapshot.max == 50002);
+}
+
+TEST_CASE("Stream Statistics - Timestamps and latency histograms", "[streaming][histogram]") {
+    Config config;
+    config.accessToken = "test-token";
+    TradierClient client(config);
+    StreamingService streaming(client);
+    StreamingConfig streamingConfig;
+    streamingConfig.recordLatency = true;
+    streaming.setConfig(streamingConfig);
+    
+    StreamSession session;
+    session.sessionId = "test";
+    session.isActive = true;
+    int quotes = 0;
+    streaming.subscribeToQuotes(session, {"SPY"}, [&quotes](const QuoteEvent&) { quotes++; });
+    
+    auto stamped = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count() - 250;
+    std::string frame = R"({"type":"quote","symbol":"SPY","bid":451.24,"bidsz":12,"bidexch":"Q","biddate":")" +
+                        std::to_string(stamped) + R"(","ask":451.26,"asksz":9,"askexch":"Z","askdate":")" +
+                        std::to_string(stamped) + R"("})";
+    
+    auto before = std::chrono::system_clock::now();
+    streaming.processMessage(frame);
+    streaming.processMessage(R"({"type":"quote","symbol":"SPY","bid":1.0,"bidsz":1,"ask":1.1,"asksz":1})");
+    
+    auto stats = streaming.getStatistics();
+    REQUIRE(quotes == 2);
+    REQUIRE(stats.messagesReceived == 2);
+    REQUIRE(stats.lastMessage >= before);
+    REQUIRE(stats.connectionStart == TimePoint{});
+    
+    // Only the stamped frame has a feed latency; both were dispatched
+    REQUIRE(stats.feedLatency.count == 1);
+    REQUIRE(stats.feedLatency.min >= 250000000);
+    REQUIRE(stats.feedLatency.min < 60000000000);
+    REQUIRE(stats.dispatchLatency.count == 2);
+    
+    streaming.resetStatistics();
+    stats = streaming.getStatistics();
+    REQUIRE(stats.feedLatency.count == 0);
+    REQUIRE(stats.dispatchLatency.count == 0);
+    REQUIRE(stats.lastMessage == TimePoint{});
+}
+
+
+TEST_CASE("Stream Statistics - Latency histograms are opt-in", "[streaming][histogram]") {
+    Config config;
+    config.accessToken = "test-token";
+    TradierClient client(config);
+    
+    for (auto mode : {DispatchMode::INLINE, DispatchMode::QUEUED}) {
+        StreamingService streaming(client);
+        StreamingConfig streamingConfig;
+        streamingConfig.dispatchMode = mode;
+        streaming.setConfig(streamingConfig);
+        
+        StreamSession session;
+        session.sessionId = "test";
+        session.isActive = true;
+        std::atomic<int> trades{0};
+        streaming.subscribeToTrades(session, {"SPY"}, [&trades](const TradeEvent&) { trades++; });
+        
+        streaming.processMessage(R"({"type":"trade","symbol":"SPY","exch":"Q","price":450.0,"size":100,"cvol":1000,"date":"1640995200000","last":450.0})");
+        streaming.disconnect();
+        
+        auto stats = streaming.getStatistics();
+        REQUIRE(trades == 1);
+        REQUIRE(stats.messagesProcessed == 1);
+        REQUIRE(stats.lastMessage != TimePoint{});
+        REQUIRE(stats.feedLatency.count == 0);
+        REQUIRE(stats.dispatchLatency.count == 0);
+    }
+}
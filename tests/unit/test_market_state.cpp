@@ -0,0 +1,189 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tradier/client.hpp"
+#include "tradier/market_state.hpp"
+#include "tradier/streaming.hpp"
+
+using namespace tradier;
+
+TEST_CASE("Market State - Quote and trade frames update the cache", "[streaming][market_state]") {
+    Config config;
+    config.accessToken = "test-token";
+    TradierClient client(config);
+    StreamingService streaming(client);
+    
+    REQUIRE(streaming.marketState() == nullptr);
+    auto cache = streaming.enableMarketState();
+    REQUIRE(cache == streaming.marketState());
+    REQUIRE(cache == streaming.enableMarketState());
+    REQUIRE(&cache->symbols() == &streaming.symbols());
+    
+    streaming.processMessage(R"({"type":"quote","symbol":"AAPL","bid":149.9,"bidsz":10,"bidexch":"Q","biddate":"1640995200000",)"
+                             R"("ask":"150.10","asksz":12,"askexch":"N","askdate":"1640995200001"})");
+    streaming.processMessage(R"({"type":"trade","symbol":"AAPL","exch":"Z","price":"150.00","size":"300","cvol":"125000",)"
+                             R"("date":"1640995200500","last":"150.00"})");
+    streaming.processMessage(R"({"type":"heartbeat"})");
+    
+    auto state = cache->snapshot("AAPL");
+    REQUIRE(state);
+    REQUIRE(state->hasQuote());
+    REQUIRE(state->hasTrade());
+    REQUIRE(state->bid == 149.9);
+    REQUIRE(state->ask == 150.10);
+    REQUIRE(state->bidSize == 10);
+    REQUIRE(state->askSize == 12);
+    REQUIRE(state->bidExchange == 'Q');
+    REQUIRE(state->askExchange == 'N');
+    REQUIRE(state->askTimeMs == 1640995200001);
+    REQUIRE(state->lastPrice == 150.0);
+    REQUIRE(state->lastSize == 300);
+    REQUIRE(state->cumulativeVolume == 125000);
+    REQUIRE(state->lastExchange == 'Z');
+    REQUIRE(state->lastTimeMs == 1640995200500);
+    
+    SECTION("Later quotes replace the book and leave the last sale") {
+        streaming.processMessage(R"({"type":"quote","symbol":"AAPL","bid":150.0,"bidsz":1,"ask":150.2,"asksz":2})");
+        state = cache->snapshot("AAPL");
+        REQUIRE(state->bid == 150.0);
+        REQUIRE(state->quoteUpdates == 2);
+        REQUIRE(state->tradeUpdates == 1);
+        REQUIRE(state->lastPrice == 150.0);
+    }
+    
+    SECTION("Filtered and unseen symbols are absent") {
+        streaming.setSymbolFilter({"AAPL"});
+        streaming.processMessage(R"({"type":"quote","symbol":"MSFT","bid":300.0,"bidsz":1,"ask":300.2,"asksz":2})");
+        REQUIRE_FALSE(cache->snapshot("MSFT"));
+        REQUIRE_FALSE(cache->snapshot("NOPE"));
+    }
+}
+
+TEST_CASE("Market State - Frames the compact decoder declines still reach compact consumers", "[streaming][market_state]") {
+    Config config;
+    config.accessToken = "test-token";
+    TradierClient client(config);
+    StreamingService streaming(client);
+    auto cache = streaming.enableMarketState();
+    
+    StreamSession session;
+    session.sessionId = "test";
+    session.isActive = true;
+    std::vector<CompactQuoteEvent> compactQuotes;
+    std::vector<CompactTradeEvent> compactTrades;
+    std::vector<QuoteEvent> quotes;
+    std::vector<std::string> errors;
+    streaming.subscribeToQuotesCompact(session, {"AAPL"}, [&](const CompactQuoteEvent& event) { compactQuotes.push_back(event); });
+    streaming.subscribeToTradesCompact(session, {"AAPL"}, [&](const CompactTradeEvent& event) { compactTrades.push_back(event); });
+    streaming.subscribeToQuotes(session, {"AAPL"}, [&](const QuoteEvent& event) { quotes.push_back(event); });
+    streaming.setErrorHandler([&](const std::string& error) { errors.push_back(error); });
+    
+    // A nested value, then more fields than the decoder scans
+    streaming.processMessage(R"({"type":"quote","symbol":"AAPL","bid":149.9,"bidsz":10,"bidexch":"Q","biddate":"1640995200000",)"
+                             R"("ask":"150.10","asksz":12,"askexch":"N","askdate":"1640995200001","meta":{"seq":1}})");
+    std::string trade = R"({"type":"trade","symbol":"AAPL","exch":"Z","price":"150.00","size":"300","cvol":"125000",)"
+                        R"("date":"1640995200500","last":"150.00")";
+    for (int i = 0; i < 40; ++i) {
+        trade += ",\"x" + std::to_string(i) + "\":" + std::to_string(i);
+    }
+    streaming.processMessage(trade + "}");
+    
+    REQUIRE(compactQuotes.size() == 1);
+    REQUIRE(compactQuotes[0].bid == 149.9);
+    REQUIRE(compactQuotes[0].ask == 150.10);
+    REQUIRE(compactQuotes[0].askSize == 12);
+    REQUIRE(compactQuotes[0].askExchange == 'N');
+    REQUIRE(compactQuotes[0].askTimeMs == 1640995200001);
+    REQUIRE(streaming.symbols().name(compactQuotes[0].symbol) == "AAPL");
+    REQUIRE(quotes.size() == 1);
+    REQUIRE(quotes[0].bid == 149.9);
+    REQUIRE(compactTrades.size() == 1);
+    REQUIRE(compactTrades[0].price == 150.0);
+    REQUIRE(compactTrades[0].cvol == 125000);
+    REQUIRE(compactTrades[0].exchange == 'Z');
+    REQUIRE(compactTrades[0].timestampMs == 1640995200500);
+    
+    auto state = cache->snapshot("AAPL");
+    REQUIRE(state);
+    REQUIRE(state->bid == 149.9);
+    REQUIRE(state->lastPrice == 150.0);
+    REQUIRE(state->lastSize == 300);
+    
+    auto stats = streaming.getStatistics();
+    REQUIRE(stats.messagesProcessed == 2);
+    REQUIRE(stats.errors == 0);
+    REQUIRE(errors.empty());
+    
+    SECTION("Frames neither path can read are counted and reported") {
+        streaming.processMessage(R"({"type":5,"symbol":"AAPL","bid":1.0})");
+        REQUIRE(streaming.getStatistics().errors == 1);
+        REQUIRE(errors.size() == 1);
+        REQUIRE(compactQuotes.size() == 1);
+    }
+}
+
+TEST_CASE("Market State - Capacity and sharded services", "[streaming][market_state]") {
+    auto symbols = std::make_shared<SymbolTable>();
+    MarketStateCache cache(symbols, 300);
+    REQUIRE(cache.capacity() == 512);
+    
+    CompactQuoteEvent quote;
+    quote.symbol = 600;
+    quote.bid = 1.0;
+    cache.apply(quote);
+    REQUIRE(cache.rejected() == 1);
+    MarketState state;
+    REQUIRE_FALSE(cache.snapshot(600, state));
+    
+    quote.symbol = 300;
+    cache.apply(quote);
+    REQUIRE(cache.snapshot(300, state));
+    REQUIRE(state.bid == 1.0);
+    
+    Config config;
+    config.accessToken = "test-token";
+    TradierClient client(config);
+    ShardedStreamingService sharded(client, 3);
+    auto shared = sharded.enableMarketState();
+    REQUIRE(sharded.shard(0).marketState() == shared);
+    REQUIRE(sharded.shard(2).marketState() == shared);
+}
+
+TEST_CASE("Market State - Readers never see torn rows", "[streaming][market_state]") {
+    auto symbols = std::make_shared<SymbolTable>();
+    SymbolId id = symbols->intern("SPY");
+    MarketStateCache cache(symbols);
+    
+    std::atomic<bool> done{false};
+    std::atomic<long> torn{0};
+    std::thread reader([&]() {
+        MarketState state;
+        while (!done.load()) {
+            if (cache.snapshot(id, state)) {
+                // The writer keeps every field of a quote consistent
+                if (state.ask != state.bid + 1.0 || state.bidSize != static_cast<int32_t>(state.bid) ||
+                    state.quoteUpdates != static_cast<uint32_t>(state.bid)) {
+                    torn++;
+                }
+            }
+        }
+    });
+    
+    CompactQuoteEvent quote;
+    quote.symbol = id;
+    for (int i = 1; i <= 200000; ++i) {
+        quote.bid = i;
+        quote.ask = i + 1.0;
+        quote.bidSize = i;
+        cache.apply(quote);
+    }
+    done = true;
+    reader.join();
+    
+    REQUIRE(torn == 0);
+    MarketState state;
+    REQUIRE(cache.snapshot(id, state));
+    REQUIRE(state.quoteUpdates == 200000);
+}
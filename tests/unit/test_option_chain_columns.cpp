@@ -0,0 +1,78 @@
+#include <catch2/catch_test_macros.hpp>
+#include "tradier/json/market.hpp"
+
+#include <stdexcept>
+
+using namespace tradier;
+
+namespace {
+
+const char* CHAIN_BODY = R"({"options":{"option":[
+    {"symbol":"SPY250117C00450000","description":"SPY Jan 17 2025 $450.00 Call","exch":"Z","type":"option",
+     "last":12.5,"change":-0.35,"volume":1520,"open":null,"bid":12.4,"ask":12.6,"underlying":"SPY",
+     "strike":450.0,"bidsize":25,"asksize":40,"open_interest":10450,"contract_size":100,
+     "expiration_date":"2025-01-17","option_type":"call","root_symbol":"SPY",
+     "greeks":{"delta":0.55,"gamma":0.012,"theta":-0.08,"vega":0.31,"rho":0.12,"phi":-0.2,
+               "bid_iv":0.18,"mid_iv":0.185,"ask_iv":0.19,"smv_vol":0.187,"updated_at":"2025-01-10 15:59:00"}},
+    null,
+    {"symbol":"SPY250117P00450000","description":"SPY Jan 17 2025 $450.00 Put","exch":"Z","type":"option",
+     "last":null,"change":null,"volume":0,"bid":3.1,"ask":3.25,"underlying":"SPY",
+     "strike":450,"bidsize":5,"asksize":7,"open_interest":880,"contract_size":10,
+     "expiration_date":"2025-01-17","option_type":"put","greeks":null}
+]}})";
+
+}
+
+TEST_CASE("Option Chain Columns - Matches row parser", "[market][json]") {
+    auto columns = json::parseOptionChainColumns(CHAIN_BODY);
+    auto rows = json::parseOptionChains(nlohmann::json::parse(CHAIN_BODY));
+    
+    REQUIRE(columns.size() == rows.size());
+    REQUIRE(columns.symbolOffsets.size() == columns.size() + 1);
+    REQUIRE(columns.underlying == "SPY");
+    REQUIRE(columns.expirationDate == "2025-01-17");
+    
+    for (size_t i = 0; i < rows.size(); ++i) {
+        REQUIRE(columns.symbol(i) == rows[i].symbol);
+        REQUIRE(columns.strike[i] == rows[i].strike);
+        REQUIRE(columns.bid[i] == rows[i].bid);
+        REQUIRE(columns.ask[i] == rows[i].ask);
+        REQUIRE(columns.volume[i] == rows[i].volume);
+        REQUIRE(columns.openInterest[i] == rows[i].openInterest);
+        REQUIRE(columns.contractSize[i] == rows[i].contractSize);
+        REQUIRE(columns.valid(i, OptionChainColumns::HAS_LAST) == rows[i].last.has_value());
+        REQUIRE(columns.valid(i, OptionChainColumns::HAS_GREEKS) == rows[i].greeks.has_value());
+        if (rows[i].greeks) {
+            REQUIRE(columns.delta[i] == rows[i].greeks->delta);
+            REQUIRE(columns.midIv[i] == rows[i].greeks->midIv);
+        }
+    }
+    
+    REQUIRE(columns.right[0] == OptionRight::CALL);
+    REQUIRE(columns.right[1] == OptionRight::PUT);
+    REQUIRE(columns.last[0] == 12.5);
+    REQUIRE(columns.change[0] == -0.35);
+    REQUIRE_FALSE(columns.valid(1, OptionChainColumns::HAS_CHANGE));
+}
+
+TEST_CASE("Option Chain Columns - Single record and empty chains", "[market][json]") {
+    SECTION("Single object instead of an array") {
+        auto columns = json::parseOptionChainColumns(
+            R"({"options":{"option":{"symbol":"AAPL250117C00200000","strike":200,"option_type":"call","underlying":"AAPL"}}})");
+        
+        REQUIRE(columns.size() == 1);
+        REQUIRE(columns.symbol(0) == "AAPL250117C00200000");
+        REQUIRE(columns.strike[0] == 200.0);
+        REQUIRE(columns.contractSize[0] == 100);
+        REQUIRE(columns.validity[0] == 0);
+    }
+    
+    SECTION("No options") {
+        REQUIRE(json::parseOptionChainColumns(R"({"options":null})").empty());
+        REQUIRE(json::parseOptionChainColumns(R"({"other":{"option":[{"strike":1}]}})").empty());
+    }
+    
+    SECTION("Malformed body") {
+        REQUIRE_THROWS_AS(json::parseOptionChainColumns(R"({"options":{"option":[{"strike":)"), std::runtime_error);
+    }
+}
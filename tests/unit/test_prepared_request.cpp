@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include "tradier/common/errors.hpp"
+#include "tradier/common/http_client.hpp"
+
+using namespace tradier;
+
+namespace {
+
+// Nothing listens on port 1, so requests fail fast with a ConnectionError
+Config unreachableConfig() {
+    Config config;
+    config.accessToken = "test-token";
+    config.baseUrlOverride = "http://127.0.0.1:1/v1";
+    config.timeoutSeconds = 2;
+    return config;
+}
+
+const HttpClient::EndpointStatistics* findEndpoint(const std::vector<HttpClient::EndpointStatistics>& all,
+                                                   const std::string& key) {
+    for (const auto& endpoint : all) {
+        if (endpoint.endpoint == key) {
+            return &endpoint;
+        }
+    }
+    return nullptr;
+}
+
+}
+
+TEST_CASE("PreparedRequest - Describes its endpoint", "[prepared]") {
+    HttpClient client(unreachableConfig());
+    
+    PreparedRequest empty;
+    REQUIRE_FALSE(empty);
+    
+    auto quotes = client.prepare("GET", "/markets/quotes");
+    REQUIRE(quotes);
+    REQUIRE(quotes.method() == "GET");
+    REQUIRE(quotes.endpoint() == "/markets/quotes");
+    
+    auto copy = quotes;
+    REQUIRE(copy.endpoint() == "/markets/quotes");
+}
+
+TEST_CASE("PreparedRequest - Only runs on the client that prepared it", "[prepared]") {
+    HttpClient client(unreachableConfig());
+    HttpClient other(unreachableConfig());
+    auto quotes = other.prepare("GET", "/markets/quotes");
+    
+    REQUIRE_THROWS_AS(client.execute(quotes, {{"symbols", "SPY"}}), ValidationError);
+    REQUIRE_THROWS_AS(client.execute(PreparedRequest{}), ValidationError);
+    REQUIRE_THROWS_AS(client.executeAsync(quotes).get(), ValidationError);
+}
+
+TEST_CASE("PreparedRequest - Outliving its client does not bind it to a new one", "[prepared]") {
+    // A new client may be allocated where the old one was; each must still
+    // reject the route rather than touch the freed client's statistics
+    for (int i = 0; i < 8; ++i) {
+        PreparedRequest quotes;
+        {
+            HttpClient expired(unreachableConfig());
+            quotes = expired.prepare("GET", "/markets/quotes");
+        }
+        HttpClient client(unreachableConfig());
+        REQUIRE_THROWS_AS(client.execute(quotes), ValidationError);
+        REQUIRE(client.getStatistics().totalRequests == 0);
+    }
+}
+
+TEST_CASE("PreparedRequest - Path suffixes share the prepared statistics", "[prepared]") {
+    HttpClient client(unreachableConfig());
+    auto cancel = client.prepare("DELETE", "/accounts/VA000001/orders/");
+    
+    REQUIRE_THROWS_AS(client.execute(cancel, {}, "42"), ConnectionError);
+    REQUIRE_THROWS_AS(client.executeAsync(cancel, {}, "43").get(), ConnectionError);
+    
+    auto all = client.getEndpointStatistics();
+    auto* stats = findEndpoint(all, "DELETE /accounts/{id}/orders/{id}");
+    REQUIRE(stats != nullptr);
+    REQUIRE(stats->requests == 2);
+    REQUIRE(stats->failures == 2);
+    REQUIRE(stats->latency.count == 2);
+    
+    // Blocking and async failures are counted the same way
+    auto totals = client.getStatistics();
+    REQUIRE(totals.totalRequests == 2);
+    REQUIRE(totals.failedRequests == 2);
+    REQUIRE(totals.successfulRequests == 0);
+}
@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+#include "fixtures/loopback_server.h"
+#include "tradier/common/async.hpp"
+#include "tradier/common/http_client.hpp"
+
+using namespace tradier;
+using namespace std::chrono_literals;
+
+TEST_CASE("RateLimiter - Burst then steady refill", "[ratelimit]") {
+    RateLimiter limiter(10, 1000ms);
+    REQUIRE(limiter.capacity() == 10);
+    REQUIRE(limiter.available() > 9.9);
+    
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(limiter.tryAcquire());
+    }
+    REQUIRE_FALSE(limiter.tryAcquire());
+    REQUIRE(limiter.available() < 1.0);
+    
+    // Reservations queue up one interval (100ms) apart
+    auto first = limiter.reserve();
+    auto second = limiter.reserve();
+    REQUIRE(first > 50ms);
+    REQUIRE(first <= 100ms);
+    REQUIRE(second - first > 90ms);
+    REQUIRE(second - first < 110ms);
+}
+
+TEST_CASE("RateLimiter - Concurrent acquires never exceed the burst", "[ratelimit]") {
+    RateLimiter limiter(1000, std::chrono::hours(1));
+    std::atomic<int> granted{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 1000; ++i) {
+                if (limiter.tryAcquire()) {
+                    granted++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(granted == 1000);
+}
+
+TEST_CASE("RateLimiter - Server feedback tightens the bucket", "[ratelimit]") {
+    RateLimiter limiter(120, 60000ms);
+    
+    SECTION("Fewer requests remaining than the bucket holds") {
+        limiter.calibrate(3, 0ms);
+        REQUIRE(limiter.tryAcquire());
+        REQUIRE(limiter.tryAcquire());
+        REQUIRE(limiter.tryAcquire());
+        REQUIRE_FALSE(limiter.tryAcquire());
+    }
+    
+    SECTION("Exhausted until the window resets") {
+        limiter.calibrate(0, 300ms);
+        REQUIRE_FALSE(limiter.tryAcquire());
+        auto wait = limiter.reserve();
+        REQUIRE(wait > 250ms);
+        REQUIRE(wait <= 300ms);
+    }
+    
+    SECTION("Remaining requests go out before the reset, then it waits") {
+        limiter.calibrate(10, 60000ms);
+        REQUIRE(limiter.available() == 10.0);
+        REQUIRE(limiter.reserve() == 0ns);
+        for (int i = 0; i < 9; ++i) {
+            REQUIRE(limiter.tryAcquire());
+        }
+        REQUIRE_FALSE(limiter.tryAcquire());
+        auto wait = limiter.reserve();
+        REQUIRE(wait > 59000ms);
+        REQUIRE(wait <= 60000ms);
+    }
+    
+    SECTION("A nearly full server budget keeps the burst") {
+        limiter.calibrate(119, 60000ms);
+        for (int i = 0; i < 119; ++i) {
+            REQUIRE(limiter.tryAcquire());
+        }
+        REQUIRE_FALSE(limiter.tryAcquire());
+    }
+    
+    SECTION("Later reports for the same window only lower the count") {
+        limiter.calibrate(5, 60000ms);
+        limiter.calibrate(50, 60000ms);
+        REQUIRE(limiter.available() == 5.0);
+        limiter.calibrate(2, 60000ms);
+        REQUIRE(limiter.tryAcquire());
+        REQUIRE(limiter.tryAcquire());
+        REQUIRE_FALSE(limiter.tryAcquire());
+    }
+    
+    SECTION("A generous report changes nothing") {
+        limiter.calibrate(500, 10ms);
+        REQUIRE(limiter.available() > 119.0);
+    }
+    
+    SECTION("Rates can change in place") {
+        limiter.setRate(2, 1000ms);
+        REQUIRE(limiter.capacity() == 2);
+        REQUIRE(limiter.window() == 1000ms);
+    }
+}
+
+TEST_CASE("RateLimiter - Reported budget is usable before the reset", "[ratelimit]") {
+    // Counts down from 10 in a window that resets a minute from now
+    std::atomic<int> available{10};
+    auto expiry = std::chrono::duration_cast<std::chrono::milliseconds>(
+        (std::chrono::system_clock::now() + 60s).time_since_epoch()).count();
+    test::LoopbackServer server([&available, expiry](const test::LoopbackServer::Request&) {
+        return test::LoopbackServer::response(200, "{}",
+            "X-Ratelimit-Available: " + std::to_string(--available) + "\r\n"
+            "X-Ratelimit-Expiry: " + std::to_string(expiry) + "\r\n");
+    });
+    HttpClient client(server.config());
+    client.enableRateLimit();
+    
+    auto started = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(client.get("/markets/quotes").status == 200);
+    }
+    REQUIRE(std::chrono::steady_clock::now() - started < 1s);
+    REQUIRE(client.getStatistics().rateLimitedRequests == 0);
+    
+    // The server reported none left: the next one waits for the reset
+    auto held = client.getAsync("/markets/quotes");
+    REQUIRE(held.wait_for(200ms) == std::future_status::timeout);
+    REQUIRE(client.getStatistics().rateLimitedRequests == 1);
+}
+
+TEST_CASE("RateLimiter - Endpoint categories", "[ratelimit]") {
+    REQUIRE(HttpClient::rateLimitCategory("GET", "/markets/quotes") == RateLimitCategory::MARKET_DATA);
+    REQUIRE(HttpClient::rateLimitCategory("POST", "/markets/quotes") == RateLimitCategory::MARKET_DATA);
+    REQUIRE(HttpClient::rateLimitCategory("POST", "/accounts/VA000001/orders") == RateLimitCategory::TRADING);
+    REQUIRE(HttpClient::rateLimitCategory("DELETE", "/accounts/VA000001/orders/123") == RateLimitCategory::TRADING);
+    REQUIRE(HttpClient::rateLimitCategory("GET", "/accounts/VA000001/orders") == RateLimitCategory::STANDARD);
+    REQUIRE(HttpClient::rateLimitCategory("GET", "/user/profile") == RateLimitCategory::STANDARD);
+    REQUIRE(HttpClient::rateLimitCategory("POST", "/watchlists") == RateLimitCategory::STANDARD);
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "tradier/json/market.hpp"
+#include "tradier/json/record_stream.hpp"
+
+using namespace tradier;
+
+namespace {
+
+const std::string HISTORY = R"({
+    "history": {
+        "day": [
+            {"date": "2024-01-02", "open": 187.15, "high": 188.44, "low": 183.885, "close": 185.64, "volume": 82488674},
+            {"date": "2024-01-03", "open": 184.22, "high": 185.88, "low": 183.43, "close": 184.25, "volume": 58414460},
+            {"date": "2024-01-04", "open": 182.15, "high": 183.0872, "low": 180.88, "close": 181.91, "volume": 71983570}
+        ]
+    }
+})";
+
+std::vector<std::string> split(const std::string& body, std::vector<std::string> path, size_t chunkSize) {
+    std::vector<std::string> records;
+    json::RecordStream stream(std::move(path), [&](std::string_view record) { records.emplace_back(record); });
+    for (size_t offset = 0; offset < body.size(); offset += chunkSize) {
+        stream.feed(std::string_view(body).substr(offset, chunkSize));
+    }
+    stream.finish();
+    REQUIRE(stream.records() == records.size());
+    return records;
+}
+
+}
+
+TEST_CASE("RecordStream - Rows match the buffered parser at any chunk size", "[recordstream]") {
+    auto expected = json::parseHistoricalDataList(nlohmann::json::parse(HISTORY));
+    REQUIRE(expected.size() == 3);
+    
+    for (size_t chunkSize : {size_t(1), size_t(7), size_t(64), HISTORY.size()}) {
+        auto records = split(HISTORY, {"history", "day"}, chunkSize);
+        REQUIRE(records.size() == expected.size());
+        for (size_t i = 0; i < records.size(); ++i) {
+            auto row = json::parseHistoricalData(nlohmann::json::parse(records[i]));
+            REQUIRE(row.date == expected[i].date);
+            REQUIRE(row.close == expected[i].close);
+            REQUIRE(row.volume == expected[i].volume);
+        }
+    }
+}
+
+TEST_CASE("RecordStream - SAX row parsers match the DOM parsers", "[recordstream]") {
+    for (const auto& record : split(HISTORY, {"history", "day"}, 16)) {
+        auto expected = json::parseHistoricalData(nlohmann::json::parse(record));
+        auto row = json::parseHistoricalDataRow(record);
+        REQUIRE(row.date == expected.date);
+        REQUIRE(row.open == expected.open);
+        REQUIRE(row.high == expected.high);
+        REQUIRE(row.low == expected.low);
+        REQUIRE(row.close == expected.close);
+        REQUIRE(row.volume == expected.volume);
+    }
+    
+    auto sale = json::parseTimeSalesRow(R"({"time": "2024-01-02T09:30:00", "timestamp": 1704205800, "price": 187.1,
+                                            "open": 187.15, "high": 187.2, "low": 187.0, "close": 187.1,
+                                            "volume": 1200, "vwap": 187.11, "extra": {"price": 1}})");
+    REQUIRE(sale.time == "2024-01-02T09:30:00");
+    REQUIRE(sale.timestamp == 1704205800);
+    REQUIRE(sale.price == 187.1);
+    REQUIRE(sale.volume == 1200);
+    REQUIRE(sale.vwap == 187.11);
+    
+    auto security = json::parseSecurityRow(R"({"symbol": "AAPL", "exchange": "Q", "type": "stock", "description": "Apple Inc"})");
+    REQUIRE(security.symbol == "AAPL");
+    REQUIRE(security.description == "Apple Inc");
+    
+    REQUIRE_THROWS_AS(json::parseSecurityRow(R"({"symbol": )"), std::runtime_error);
+}
+
+TEST_CASE("RecordStream - Skips everything off the path", "[recordstream]") {
+    std::string body = R"({"meta": {"day": [{"skip": 1}], "note": "{\"day\": [}"},
+                           "series": {"day": [{"wrong": true}], "data": [{"time": "a]}\"{"}, null, {"time": "b"}]},
+                           "tail": [1, 2, {"data": []}]})";
+    
+    auto records = split(body, {"series", "data"}, 5);
+    REQUIRE(records.size() == 2);
+    REQUIRE(nlohmann::json::parse(records[0])["time"] == "a]}\"{");
+    REQUIRE(nlohmann::json::parse(records[1])["time"] == "b");
+}
+
+TEST_CASE("RecordStream - Single rows and empty lists", "[recordstream]") {
+    auto single = split(R"({"securities": {"security": {"symbol": "AAPL", "nested": {"a": [1]}}}})",
+                        {"securities", "security"}, 3);
+    REQUIRE(single.size() == 1);
+    REQUIRE(nlohmann::json::parse(single[0])["symbol"] == "AAPL");
+    
+    REQUIRE(split(R"({"history": null})", {"history", "day"}, 4).empty());
+    REQUIRE(split(R"({"history": {"day": []}})", {"history", "day"}, 4).empty());
+}
+
+TEST_CASE("RecordStream - Rejects malformed documents", "[recordstream]") {
+    auto ignore = [](std::string_view) {};
+    
+    json::RecordStream mismatched({"history", "day"}, ignore);
+    REQUIRE_THROWS_AS(mismatched.feed(R"({"history": {"day": [}})"), std::runtime_error);
+    
+    json::RecordStream truncated({"history", "day"}, ignore);
+    truncated.feed(R"({"history": {"day": [{"date": "2024-01-02"})");
+    REQUIRE(truncated.records() == 1);
+    REQUIRE_THROWS_AS(truncated.finish(), std::runtime_error);
+    
+    json::RecordStream trailing({"history", "day"}, ignore);
+    REQUIRE_THROWS_AS(trailing.feed(R"({"history": {}} {})"), std::runtime_error);
+    
+    json::RecordStream notJson({"history", "day"}, ignore);
+    REQUIRE_THROWS_AS(notJson.feed("Invalid access token"), std::runtime_error);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tradier/common/request_scheduler.hpp"
+#include "tradier/common/http_client.hpp"
+
+using namespace tradier;
+using namespace std::chrono_literals;
+
+TEST_CASE("RequestScheduler - Freed slots go to the highest priority waiter", "[scheduler]") {
+    RequestScheduler scheduler(1);
+    std::vector<std::string> order;
+    
+    scheduler.submit(RequestPriority::BULK, [&] { order.push_back("bulk-1"); }, nullptr);
+    REQUIRE(order.size() == 1);
+    
+    scheduler.submit(RequestPriority::BULK, [&] { order.push_back("bulk-2"); }, nullptr);
+    scheduler.submit(RequestPriority::QUOTES, [&] { order.push_back("quotes"); }, nullptr);
+    scheduler.submit(RequestPriority::TRADING, [&] { order.push_back("trading"); }, nullptr);
+    REQUIRE(scheduler.queued(RequestPriority::BULK) == 1);
+    
+    scheduler.release(RequestPriority::BULK);
+    scheduler.release(RequestPriority::TRADING);
+    scheduler.release(RequestPriority::QUOTES);
+    scheduler.release(RequestPriority::BULK);
+    
+    REQUIRE(order == std::vector<std::string>{"bulk-1", "trading", "quotes", "bulk-2"});
+    REQUIRE(scheduler.running(RequestPriority::BULK) == 0);
+}
+
+TEST_CASE("RequestScheduler - Class caps leave room for other classes", "[scheduler]") {
+    RequestScheduler scheduler(4);
+    scheduler.setLimits(RequestPriority::BULK, 1, 0ms);
+    int bulkStarted = 0;
+    int accountStarted = 0;
+    
+    for (int i = 0; i < 3; ++i) {
+        scheduler.submit(RequestPriority::BULK, [&] { bulkStarted++; }, nullptr);
+    }
+    REQUIRE(bulkStarted == 1);
+    REQUIRE(scheduler.queued(RequestPriority::BULK) == 2);
+    
+    for (int i = 0; i < 4; ++i) {
+        scheduler.submit(RequestPriority::ACCOUNT, [&] { accountStarted++; }, nullptr);
+    }
+    REQUIRE(accountStarted == 3);
+    
+    scheduler.release(RequestPriority::BULK);
+    REQUIRE(accountStarted == 4);
+    REQUIRE(bulkStarted == 1);
+    
+    scheduler.release(RequestPriority::ACCOUNT);
+    REQUIRE(bulkStarted == 2);
+}
+
+TEST_CASE("RequestScheduler - Stale waiters are dropped", "[scheduler]") {
+    RequestScheduler scheduler(1);
+    scheduler.setLimits(RequestPriority::QUOTES, 1, 20ms);
+    int started = 0;
+    int dropped = 0;
+    
+    scheduler.submit(RequestPriority::ACCOUNT, [&] { started++; }, [&] { dropped++; });
+    scheduler.submit(RequestPriority::QUOTES, [&] { started++; }, [&] { dropped++; });
+    std::this_thread::sleep_for(40ms);
+    
+    scheduler.release(RequestPriority::ACCOUNT);
+    REQUIRE(started == 1);
+    REQUIRE(dropped == 1);
+    REQUIRE(scheduler.queued(RequestPriority::QUOTES) == 0);
+}
+
+TEST_CASE("RequestScheduler - Cancel removes a queued waiter", "[scheduler]") {
+    RequestScheduler scheduler(1);
+    int started = 0;
+    
+    auto running = scheduler.submit(RequestPriority::ACCOUNT, [&] { started++; }, nullptr);
+    auto waiting = scheduler.submit(RequestPriority::ACCOUNT, [&] { started++; }, nullptr);
+    REQUIRE_FALSE(scheduler.cancel(RequestPriority::ACCOUNT, running));
+    REQUIRE(scheduler.cancel(RequestPriority::ACCOUNT, waiting));
+    
+    scheduler.release(RequestPriority::ACCOUNT);
+    REQUIRE(started == 1);
+    REQUIRE(scheduler.running(RequestPriority::ACCOUNT) == 0);
+}
+
+TEST_CASE("HttpClient - Request priority classification", "[scheduler]") {
+    REQUIRE(HttpClient::requestPriority("POST", "/accounts/VA000001/orders") == RequestPriority::TRADING);
+    REQUIRE(HttpClient::requestPriority("DELETE", "/accounts/VA000001/orders/42") == RequestPriority::TRADING);
+    REQUIRE(HttpClient::requestPriority("GET", "/accounts/VA000001/orders") == RequestPriority::ACCOUNT);
+    REQUIRE(HttpClient::requestPriority("GET", "/user/profile") == RequestPriority::ACCOUNT);
+    REQUIRE(HttpClient::requestPriority("GET", "/markets/quotes") == RequestPriority::QUOTES);
+    REQUIRE(HttpClient::requestPriority("GET", "/markets/options/chains") == RequestPriority::QUOTES);
+    REQUIRE(HttpClient::requestPriority("GET", "/markets/history") == RequestPriority::BULK);
+    REQUIRE(HttpClient::requestPriority("GET", "markets/timesales") == RequestPriority::BULK);
+    REQUIRE(HttpClient::requestPriority("GET", "/beta/markets/fundamentals/company") == RequestPriority::BULK);
+}
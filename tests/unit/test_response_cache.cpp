@@ -0,0 +1,207 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "fixtures/loopback_server.h"
+#include "tradier/client.hpp"
+#include "tradier/common/response_cache.hpp"
+#include "tradier/market.hpp"
+
+using namespace tradier;
+using namespace std::chrono_literals;
+
+namespace {
+
+ResponseCache::Value value(int number) {
+    return std::make_shared<const int>(number);
+}
+
+int read(const ResponseCache::Entry& entry) {
+    return *std::static_pointer_cast<const int>(entry.value);
+}
+
+// Serves option expirations with an ETag, answering 304 to requests that
+// carry it
+class ExpirationsServer : public test::LoopbackServer {
+public:
+    std::atomic<int> notModified{0};
+    
+    ExpirationsServer() : LoopbackServer([this](const Request& request) { return respond(request); }) {}
+    
+    Config config() const {
+        Config config = LoopbackServer::config();
+        config.cacheReferenceData = true;
+        return config;
+    }
+
+private:
+    std::string respond(const Request& request) {
+        if (request.contains("If-None-Match: \"v1\"")) {
+            notModified++;
+            return response(304, "", "ETag: \"v1\"\r\n");
+        }
+        return response(200,
+                        R"({"expirations":{"expiration":[{"date":"2025-06-20","contract_size":100,"expiration_type":"weeklys"},)"
+                        R"({"date":"2025-06-27","contract_size":100,"expiration_type":"weeklys"}]}})",
+                        "ETag: \"v1\"\r\n");
+    }
+};
+
+}
+
+TEST_CASE("ResponseCache - Reference endpoints have default TTLs", "[responsecache]") {
+    ResponseCache cache;
+    
+    REQUIRE(cache.ttl("/markets/options/expirations") == 5min);
+    REQUIRE(cache.ttl("/markets/calendar") == 60min);
+    REQUIRE(cache.ttl("/beta/markets/fundamentals/dividends") == 60min);
+    REQUIRE(cache.ttl("/markets/quotes") == 0ms);
+    
+    cache.setTtl("/markets/quotes", 250ms);
+    cache.setTtl("/markets/calendar", 0ms);
+    REQUIRE(cache.ttl("/markets/quotes") == 250ms);
+    REQUIRE(cache.ttl("/markets/calendar") == 0ms);
+}
+
+TEST_CASE("ResponseCache - Entries are fresh until their TTL runs out", "[responsecache]") {
+    ResponseCache cache;
+    REQUIRE_FALSE(cache.lookup("spy"));
+    
+    cache.store("spy", value(1), {{"etag", "\"v1\""}, {"Last-Modified", "Mon, 02 Jun 2025 00:00:00 GMT"}}, 100, 20ms);
+    auto entry = cache.lookup("spy");
+    REQUIRE(entry);
+    REQUIRE(entry->fresh);
+    REQUIRE(read(*entry) == 1);
+    REQUIRE(entry->etag == "\"v1\"");
+    
+    std::this_thread::sleep_for(30ms);
+    entry = cache.lookup("spy");
+    REQUIRE(entry);
+    REQUIRE_FALSE(entry->fresh);
+    
+    auto headers = entry->conditionalHeaders();
+    REQUIRE(headers["If-None-Match"] == "\"v1\"");
+    REQUIRE(headers["If-Modified-Since"] == "Mon, 02 Jun 2025 00:00:00 GMT");
+    
+    auto stats = cache.statistics();
+    REQUIRE(stats.misses == 1);
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.stale == 1);
+    REQUIRE(stats.entries == 1);
+}
+
+TEST_CASE("ResponseCache - A 304 keeps the value and renews it", "[responsecache]") {
+    ResponseCache cache;
+    cache.store("spy", value(7), {{"ETag", "\"v1\""}}, 100, 0ms);
+    
+    auto stale = cache.lookup("spy");
+    REQUIRE(stale);
+    REQUIRE_FALSE(stale->fresh);
+    REQUIRE(stale->conditionalHeaders().count("If-Modified-Since") == 0);
+    
+    cache.refresh("spy", *stale, {{"Last-Modified", "Tue, 03 Jun 2025 00:00:00 GMT"}}, 1min);
+    auto renewed = cache.lookup("spy");
+    REQUIRE(renewed);
+    REQUIRE(renewed->fresh);
+    REQUIRE(read(*renewed) == 7);
+    REQUIRE(renewed->etag == "\"v1\"");
+    REQUIRE(renewed->lastModified == "Tue, 03 Jun 2025 00:00:00 GMT");
+    REQUIRE(renewed->bytes == stale->bytes);
+    REQUIRE(cache.statistics().notModified == 1);
+}
+
+TEST_CASE("ResponseCache - Evicts least recently used entries beyond the cap", "[responsecache]") {
+    ResponseCache probe;
+    probe.store("k0", value(0), {}, 1000, 1min);
+    size_t entryBytes = probe.statistics().bytes;
+    
+    ResponseCache cache(entryBytes * 3);
+    cache.store("k0", value(0), {}, 1000, 1min);
+    cache.store("k1", value(1), {}, 1000, 1min);
+    cache.store("k2", value(2), {}, 1000, 1min);
+    REQUIRE(cache.lookup("k0"));
+    
+    cache.store("k3", value(3), {}, 1000, 1min);
+    REQUIRE_FALSE(cache.lookup("k1"));
+    REQUIRE(cache.lookup("k0"));
+    REQUIRE(cache.lookup("k2"));
+    REQUIRE(cache.lookup("k3"));
+    
+    auto stats = cache.statistics();
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.entries == 3);
+    REQUIRE(stats.bytes <= entryBytes * 3);
+    
+    cache.store("huge", value(4), {}, entryBytes * 4, 1min);
+    REQUIRE_FALSE(cache.lookup("huge"));
+    REQUIRE(cache.statistics().entries == 3);
+    
+    cache.setMaxBytes(entryBytes);
+    REQUIRE(cache.statistics().entries == 1);
+    REQUIRE(cache.lookup("k3"));
+}
+
+TEST_CASE("ResponseCache - Replacing an entry keeps the byte count exact", "[responsecache]") {
+    ResponseCache cache;
+    cache.store("spy", value(1), {}, 1000, 1min);
+    size_t bytes = cache.statistics().bytes;
+    
+    cache.store("spy", value(2), {}, 1000, 1min);
+    REQUIRE(cache.statistics().bytes == bytes);
+    REQUIRE(read(*cache.lookup("spy")) == 2);
+    
+    cache.clear();
+    REQUIRE(cache.statistics().entries == 0);
+    REQUIRE(cache.statistics().bytes == 0);
+}
+
+TEST_CASE("ResponseCache - Only created when configured", "[responsecache]") {
+    Config config;
+    config.accessToken = "token";
+    REQUIRE_FALSE(TradierClient(config).responseCache());
+    
+    config.cacheReferenceData = true;
+    TradierClient client(config);
+    REQUIRE(client.responseCache());
+}
+
+TEST_CASE("ResponseCache - MarketService serves hits and revalidates stale entries", "[responsecache]") {
+    ExpirationsServer server;
+    TradierClient client(server.config());
+    auto market = client.market();
+    
+    auto first = market.getOptionExpirations("SPY");
+    REQUIRE(first.isSuccess());
+    REQUIRE(first.value().size() == 2);
+    REQUIRE(market.getOptionExpirations("SPY").value().size() == 2);
+    REQUIRE(server.requests() == 1);
+    
+    client.responseCache()->setTtl("/markets/options/expirations", 1ms);
+    market.getOptionExpirations("QQQ");
+    std::this_thread::sleep_for(5ms);
+    
+    auto revalidated = market.getOptionExpirations("QQQ");
+    REQUIRE(revalidated.isSuccess());
+    REQUIRE(revalidated.value().size() == 2);
+    REQUIRE(server.requests() == 3);
+    REQUIRE(server.notModified == 1);
+    
+    std::this_thread::sleep_for(5ms);
+    auto async = market.getOptionExpirationsAsync("QQQ").get();
+    REQUIRE(async.isSuccess());
+    REQUIRE(async.value().size() == 2);
+    REQUIRE(server.notModified == 2);
+    
+    auto stats = client.responseCache()->statistics();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.stale == 2);
+    REQUIRE(stats.notModified == 2);
+    
+    client.responseCache()->setTtl("/markets/options/expirations", 0ms);
+    market.getOptionExpirations("SPY");
+    REQUIRE(server.requests() == 5);
+}
@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include "fixtures/loopback_server.h"
+#include "tradier/common/http_client.hpp"
+
+using namespace tradier;
+
+namespace {
+
+const std::string BODY = [] {
+    std::string body = R"({"quotes":{"quote":[)";
+    for (int i = 0; i < 200; ++i) {
+        body += std::string(i > 0 ? "," : "") + R"({"symbol":"SPY","last":512.34,"volume":48213577})";
+    }
+    return body + "]}}";
+}();
+
+// gzip-encodes BODY only if the client offered it
+std::string quotes(const test::LoopbackServer::Request& request) {
+    if (!request.contains("gzip")) {
+        return test::LoopbackServer::response(200, BODY);
+    }
+    return test::LoopbackServer::response(200, test::gzip(BODY), "Content-Encoding: gzip\r\n");
+}
+
+Config config(const test::LoopbackServer& server, bool compress) {
+    Config config = server.config();
+    config.compressResponses = compress;
+    return config;
+}
+
+}
+
+TEST_CASE("Compression - gzip bodies are decoded and counted on both sides", "[compression]") {
+    test::LoopbackServer server(quotes);
+    HttpClient client(config(server, true));
+    
+    auto response = client.get("/markets/quotes");
+    REQUIRE(response.status == 200);
+    REQUIRE(response.body == BODY);
+    REQUIRE(server.lastRequest().contains("Accept-Encoding:"));
+    
+    auto stats = client.getStatistics();
+    REQUIRE(stats.uncompressedBytesReceived == BODY.size());
+    REQUIRE(stats.compressedBytesReceived == test::gzip(BODY).size());
+    REQUIRE(stats.compressedBytesReceived < BODY.size() / 4);
+    
+    auto endpoints = client.getEndpointStatistics();
+    REQUIRE(endpoints.size() == 1);
+    REQUIRE(endpoints[0].compressedBytes == stats.compressedBytesReceived);
+    REQUIRE(endpoints[0].uncompressedBytes == BODY.size());
+}
+
+TEST_CASE("Compression - Streamed bodies arrive decoded", "[compression]") {
+    test::LoopbackServer server(quotes);
+    HttpClient client(config(server, true));
+    
+    std::string streamed;
+    auto response = client.getStreaming("/markets/quotes", {}, [&streamed](std::string_view chunk) { streamed += chunk; });
+    REQUIRE(response.status == 200);
+    REQUIRE(response.body.empty());
+    REQUIRE(streamed == BODY);
+    REQUIRE(client.getStatistics().uncompressedBytesReceived == BODY.size());
+}
+
+TEST_CASE("Compression - Disabled clients do not offer an encoding", "[compression]") {
+    test::LoopbackServer server(quotes);
+    HttpClient client(config(server, false));
+    
+    auto response = client.get("/markets/quotes");
+    REQUIRE(response.body == BODY);
+    REQUIRE_FALSE(server.lastRequest().contains("Accept-Encoding:"));
+    
+    auto stats = client.getStatistics();
+    REQUIRE(stats.compressedBytesReceived == BODY.size());
+    REQUIRE(stats.uncompressedBytesReceived == BODY.size());
+}
@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include "tradier/client.hpp"
+#include "tradier/streaming.hpp"
+
+using namespace tradier;
+
+TEST_CASE("Sharded Streaming - Symbol partitioning", "[streaming][sharded]") {
+    Config config;
+    config.accessToken = "test-token";
+    TradierClient client(config);
+    
+    ShardedStreamingService sharded(client, 4);
+    REQUIRE(sharded.shardCount() == 4);
+    
+    std::vector<size_t> perShard(4, 0);
+    for (int i = 0; i < 400; ++i) {
+        std::string symbol = "SYM" + std::to_string(i);
+        size_t shard = sharded.shardFor(symbol);
+        REQUIRE(shard < 4);
+        REQUIRE(sharded.shardFor(symbol) == shard);
+        perShard[shard]++;
+    }
+    for (size_t count : perShard) {
+        REQUIRE(count > 50);
+    }
+    
+    SECTION("Subscribing requires sessions") {
+        REQUIRE_FALSE(sharded.subscribeToTrades({"SPY"}, [](const TradeEvent&) {}));
+        REQUIRE_FALSE(sharded.isConnected());
+        REQUIRE(sharded.getStatistics().messagesReceived == 0);
+    }
+    
+    SECTION("Shards share one symbol table") {
+        REQUIRE(&sharded.shard(0).symbols() == &sharded.symbols());
+        REQUIRE(&sharded.shard(3).symbols() == &sharded.symbols());
+    }
+}
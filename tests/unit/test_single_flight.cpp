@@ -0,0 +1,144 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "fixtures/loopback_server.h"
+#include "tradier/client.hpp"
+#include "tradier/common/single_flight.hpp"
+#include "tradier/market.hpp"
+
+using namespace tradier;
+using namespace std::chrono_literals;
+
+TEST_CASE("SingleFlight - Concurrent callers share one result", "[singleflight]") {
+    SingleFlight flights;
+    std::atomic<int> produced{0};
+    std::vector<std::shared_ptr<const std::string>> results(8);
+    std::vector<std::thread> threads;
+    
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i] {
+            results[i] = flights.run<std::string>("quotes AAPL", [&] {
+                produced++;
+                std::this_thread::sleep_for(50ms);
+                return std::string("AAPL 187.50");
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    REQUIRE(produced == 1);
+    for (const auto& result : results) {
+        REQUIRE(result == results.front());
+        REQUIRE(*result == "AAPL 187.50");
+    }
+    
+    auto stats = flights.statistics();
+    REQUIRE(stats.leaders == 1);
+    REQUIRE(stats.coalesced == 7);
+    REQUIRE(flights.inFlight() == 0);
+}
+
+TEST_CASE("SingleFlight - Completed flights are not reused", "[singleflight]") {
+    SingleFlight flights;
+    int produced = 0;
+    
+    auto first = flights.run<int>("clock", [&] { return ++produced; });
+    auto second = flights.run<int>("clock", [&] { return ++produced; });
+    auto other = flights.run<int>("calendar", [&] { return ++produced; });
+    
+    REQUIRE(*first == 1);
+    REQUIRE(*second == 2);
+    REQUIRE(*other == 3);
+    REQUIRE(flights.statistics().coalesced == 0);
+}
+
+TEST_CASE("SingleFlight - Failures reach every waiter", "[singleflight]") {
+    SingleFlight flights;
+    int calls = 0;
+    std::exception_ptr shared;
+    
+    REQUIRE(flights.join("chain SPY", [&](const SingleFlight::Value& value, std::exception_ptr error) {
+        calls++;
+        REQUIRE(value == nullptr);
+        shared = error;
+    }));
+    REQUIRE_FALSE(flights.join("chain SPY", [&](const SingleFlight::Value&, std::exception_ptr error) {
+        calls++;
+        REQUIRE(error == shared);
+    }));
+    
+    flights.complete("chain SPY", nullptr, std::make_exception_ptr(std::runtime_error("timeout")));
+    REQUIRE(calls == 2);
+    REQUIRE(flights.inFlight() == 0);
+    
+    REQUIRE_THROWS_AS(flights.run<int>("chain SPY", []() -> int { throw std::runtime_error("timeout"); }),
+                      std::runtime_error);
+}
+
+TEST_CASE("SingleFlight - A throwing waiter does not strand the others", "[singleflight]") {
+    SingleFlight flights;
+    int later = 0;
+    
+    REQUIRE(flights.join("quotes SPY", [](const SingleFlight::Value&, std::exception_ptr) {
+        throw std::runtime_error("callback failure");
+    }));
+    
+    std::promise<int> joined;
+    auto result = joined.get_future();
+    std::thread joiner([&flights, &joined] {
+        joined.set_value(*flights.run<int>("quotes SPY", []() -> int { throw std::logic_error("not the leader"); }));
+    });
+    while (flights.statistics().coalesced == 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+    REQUIRE_FALSE(flights.join("quotes SPY", [&later](const SingleFlight::Value& value, std::exception_ptr) {
+        later = *std::static_pointer_cast<const int>(value);
+    }));
+    
+    flights.complete("quotes SPY", std::make_shared<const int>(42), nullptr);
+    
+    auto status = result.wait_for(2s);
+    joiner.join();
+    REQUIRE(status == std::future_status::ready);
+    REQUIRE(result.get() == 42);
+    REQUIRE(later == 42);
+    REQUIRE(flights.inFlight() == 0);
+}
+
+TEST_CASE("SingleFlight - Shares a produced pointer as is", "[singleflight]") {
+    SingleFlight flight;
+    auto produced = std::make_shared<const std::vector<int>>(std::vector<int>{1, 2, 3});
+    
+    auto shared = flight.run<std::vector<int>>("key", [&] { return produced; });
+    REQUIRE(shared == produced);
+}
+
+TEST_CASE("SingleFlight - A throwing quote callback does not strand joined calls", "[singleflight]") {
+    test::LoopbackServer server([](const test::LoopbackServer::Request&) {
+        std::this_thread::sleep_for(100ms);
+        return test::LoopbackServer::response(200,
+            R"({"quotes":{"quote":{"symbol":"SPY","description":"SPDR S&P 500","last":450.25}}})");
+    });
+    TradierClient client(server.config());
+    auto market = client.market();
+    
+    market.getQuotesAsync({"SPY"}, SimpleAsyncCallback<std::vector<Quote>>([](const Result<std::vector<Quote>>&) {
+        throw std::runtime_error("callback failure");
+    }));
+    auto joined = market.getQuotesAsync({"SPY"});
+    auto blocking = market.getQuotes({"SPY"});
+    
+    REQUIRE(blocking.isSuccess());
+    REQUIRE(blocking.value().front().symbol == "SPY");
+    REQUIRE(joined.get().isSuccess());
+    REQUIRE(server.requests() == 1);
+    REQUIRE(client.requestCoalescer()->statistics().coalesced == 2);
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+#include "tradier/client.hpp"
+#include "tradier/streaming.hpp"
+
+using namespace tradier;
+
+namespace {
+
+std::string tradeFrame(const std::string& symbol, double price) {
+    return R"({"type":"trade","symbol":")" + symbol + R"(","exch":"Z","price":)" + std::to_string(price) +
+           R"(,"size":100,"cvol":1000,"date":"1640995200000","last":)" + std::to_string(price) + "}";
+}
+
+std::string quoteFrame(const std::string& symbol, double bid) {
+    return R"({"type":"quote","symbol":")" + symbol + R"(","bid":)" + std::to_string(bid) +
+           R"(,"bidsz":1,"ask":)" + std::to_string(bid + 0.01) + R"(,"asksz":1})";
+}
+
+// Queued service whose first trade holds the consumer thread until
+// release(), so frames published meanwhile pile up in the ring and slots
+class HeldConsumer {
+private:
+    std::promise<void> entered_;
+    std::promise<void> release_;
+    std::shared_future<void> released_ = release_.get_future().share();
+    bool holding_ = true;
+
+public:
+    Config clientConfig;
+    TradierClient client;
+    StreamingService streaming;
+    StreamSession session;
+    std::vector<std::pair<std::string, double>> trades;
+    std::vector<std::pair<std::string, double>> quotes;
+    
+    explicit HeldConsumer(StreamingConfig config) : clientConfig(makeConfig()), client(clientConfig), streaming(client) {
+        config.dispatchMode = DispatchMode::QUEUED;
+        config.consumerThreads = 1;
+        streaming.setConfig(config);
+        
+        session.sessionId = "test";
+        session.isActive = true;
+        streaming.subscribeToTrades(session, {"SPY"}, [this](const TradeEvent& event) {
+            trades.emplace_back(event.symbol, event.price);
+            if (holding_) {
+                holding_ = false;
+                entered_.set_value();
+                released_.wait();
+            }
+        });
+        streaming.subscribeToQuotes(session, {"SPY"}, [this](const QuoteEvent& event) {
+            quotes.emplace_back(event.symbol, event.bid);
+        });
+    }
+    
+    static Config makeConfig() {
+        Config config;
+        config.accessToken = "test-token";
+        return config;
+    }
+    
+    // Publishes a trade and waits for the consumer to block inside it
+    void hold(const std::string& symbol, double price) {
+        streaming.processMessage(tradeFrame(symbol, price));
+        entered_.get_future().wait();
+    }
+    
+    // Lets the consumer go and waits for everything queued to be delivered
+    void drain() {
+        release_.set_value();
+        streaming.disconnect();
+    }
+};
+
+}
+
+TEST_CASE("Stream Conflation - A lagging consumer sees the latest quote per symbol", "[streaming][conflation]") {
+    StreamingConfig config;
+    config.conflateQuotes = true;
+    HeldConsumer consumer(config);
+    
+    consumer.hold("SPY", 450.0);
+    consumer.streaming.processMessage(quoteFrame("SPY", 1.0));
+    consumer.streaming.processMessage(quoteFrame("AAPL", 10.0));
+    consumer.streaming.processMessage(quoteFrame("SPY", 2.0));
+    consumer.streaming.processMessage(quoteFrame("SPY", 3.0));
+    consumer.streaming.processMessage(quoteFrame("AAPL", 11.0));
+    consumer.drain();
+    
+    REQUIRE(consumer.quotes == std::vector<std::pair<std::string, double>>{{"SPY", 3.0}, {"AAPL", 11.0}});
+    
+    auto stats = consumer.streaming.getStatistics();
+    REQUIRE(stats.quotesConflated == 3);
+    REQUIRE(stats.eventsConflated == 0);
+    REQUIRE(stats.eventsQueued == 1);
+    REQUIRE(stats.messagesProcessed == 6);
+}
+
+TEST_CASE("Stream Conflation - Quotes delivered before further updates are not conflated", "[streaming][conflation]") {
+    StreamingConfig config;
+    config.conflateQuotes = true;
+    HeldConsumer consumer(config);
+    
+    consumer.hold("SPY", 450.0);
+    consumer.drain();
+    
+    consumer.streaming.processMessage(quoteFrame("SPY", 1.0));
+    consumer.streaming.disconnect();
+    consumer.streaming.processMessage(quoteFrame("SPY", 2.0));
+    consumer.streaming.disconnect();
+    
+    REQUIRE(consumer.quotes == std::vector<std::pair<std::string, double>>{{"SPY", 1.0}, {"SPY", 2.0}});
+    REQUIRE(consumer.streaming.getStatistics().quotesConflated == 0);
+}
+
+TEST_CASE("Stream Conflation - CONFLATE overflow drains newest-last after the ring", "[streaming][conflation]") {
+    StreamingConfig config;
+    config.queueCapacity = 2;
+    config.overflowPolicy = OverflowPolicy::CONFLATE;
+    HeldConsumer consumer(config);
+    
+    consumer.hold("A", 1.0);
+    consumer.streaming.processMessage(tradeFrame("B", 1.0));
+    consumer.streaming.processMessage(tradeFrame("C", 1.0));
+    
+    // The ring is full: these wait in per-symbol slots, and once any is
+    // pending later events join them even for symbols still in the ring
+    consumer.streaming.processMessage(tradeFrame("D", 1.0));
+    consumer.streaming.processMessage(tradeFrame("B", 2.0));
+    consumer.streaming.processMessage(tradeFrame("D", 2.0));
+    consumer.streaming.processMessage(tradeFrame("D", 3.0));
+    consumer.drain();
+    
+    REQUIRE(consumer.trades == std::vector<std::pair<std::string, double>>{
+        {"A", 1.0}, {"B", 1.0}, {"C", 1.0}, {"D", 3.0}, {"B", 2.0}});
+    
+    auto stats = consumer.streaming.getStatistics();
+    REQUIRE(stats.eventsQueued == 3);
+    REQUIRE(stats.eventsConflated == 2);
+    REQUIRE(stats.eventsDropped == 0);
+    REQUIRE(stats.queueHighWater == 2);
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+#include "tradier/json/streaming.hpp"
+
+using namespace tradier;
+using json::StreamDecodeStatus;
+
+TEST_CASE("Stream Decoder - Quote", "[streaming][json]") {
+    json::StreamEventBuffer buffer;
+    auto status = json::decodeStreamEvent(
+        R"({"type":"quote","symbol":"AAPL","bid":149.9,"bidsz":10,"bidexch":"Q","biddate":"1640995200000",)"
+        R"("ask":"150.10","asksz":12,"askexch":"Q","askdate":"1640995200000"})", buffer);
+    
+    REQUIRE(status == StreamDecodeStatus::QUOTE);
+    REQUIRE(buffer.quote.type == "quote");
+    REQUIRE(buffer.quote.symbol == "AAPL");
+    REQUIRE(buffer.quote.bid == 149.9);
+    REQUIRE(buffer.quote.ask == 150.10);
+    REQUIRE(buffer.quote.bidSize == 10);
+    REQUIRE(buffer.quote.askSize == 12);
+    REQUIRE(buffer.quote.bidExchange == "Q");
+    REQUIRE(buffer.quote.askDate == "1640995200000");
+    REQUIRE_FALSE(buffer.hasExchange);
+}
+
+TEST_CASE("Stream Decoder - Trade and Timesale", "[streaming][json]") {
+    json::StreamEventBuffer buffer;
+    
+    SECTION("Trade with whitespace and string numerics") {
+        auto status = json::decodeStreamEvent(R"({ "type": "trade", "symbol": "SPY", "exch": "Z",
+            "price": "451.25", "size": "100", "cvol": "3400000", "date": "1640995200000", "last": "451.25" })", buffer);
+        
+        REQUIRE(status == StreamDecodeStatus::TRADE);
+        REQUIRE(buffer.trade.symbol == "SPY");
+        REQUIRE(buffer.trade.exchange == "Z");
+        REQUIRE(buffer.trade.price == 451.25);
+        REQUIRE(buffer.trade.size == 100);
+        REQUIRE(buffer.trade.cvol == 3400000);
+        REQUIRE(buffer.hasExchange);
+        REQUIRE(buffer.exchange == "Z");
+    }
+    
+    SECTION("Timesale booleans") {
+        auto status = json::decodeStreamEvent(
+            R"({"type":"timesale","symbol":"SPY","exch":"Q","bid":"1.5","ask":"1.6","last":"1.55",)"
+            R"("size":"200","date":"1640995200000","seq":42,"flag":"","cancel":false,"correction":true,"session":"normal"})",
+            buffer);
+        
+        REQUIRE(status == StreamDecodeStatus::TIMESALE);
+        REQUIRE(buffer.timesale.seq == 42);
+        REQUIRE(buffer.timesale.size == 200);
+        REQUIRE_FALSE(buffer.timesale.cancel);
+        REQUIRE(buffer.timesale.correction);
+        REQUIRE(buffer.timesale.session == "normal");
+    }
+}
+
+TEST_CASE("Stream Decoder - Reused buffer is reset", "[streaming][json]") {
+    json::StreamEventBuffer buffer;
+    
+    REQUIRE(json::decodeStreamEvent(R"({"type":"summary","symbol":"A","open":1,"high":2,"low":0.5,"prevClose":1.1})", buffer)
+            == StreamDecodeStatus::SUMMARY);
+    REQUIRE(buffer.summary.high == 2.0);
+    
+    REQUIRE(json::decodeStreamEvent(R"({"type":"summary","symbol":"B","open":"","high":null})", buffer)
+            == StreamDecodeStatus::SUMMARY);
+    REQUIRE(buffer.summary.symbol == "B");
+    REQUIRE(buffer.summary.open == 0.0);
+    REQUIRE(buffer.summary.high == 0.0);
+    REQUIRE(buffer.summary.prevClose == 0.0);
+}
+
+TEST_CASE("Stream Decoder - Fallback cases", "[streaming][json]") {
+    json::StreamEventBuffer buffer;
+    
+    REQUIRE(json::decodeStreamEvent(R"({"type":"heartbeat"})", buffer) == StreamDecodeStatus::IGNORED);
+    REQUIRE(json::decodeStreamEvent(R"({"symbol":"AAPL"})", buffer) == StreamDecodeStatus::IGNORED);
+    REQUIRE(json::decodeStreamEvent("{}", buffer) == StreamDecodeStatus::IGNORED);
+    
+    REQUIRE(json::decodeStreamEvent(R"({"type":"quote","symbol":"A\"B"})", buffer) == StreamDecodeStatus::UNSUPPORTED);
+    REQUIRE(json::decodeStreamEvent(R"({"type":"quote","nested":{"a":1}})", buffer) == StreamDecodeStatus::UNSUPPORTED);
+    REQUIRE(json::decodeStreamEvent(R"({"type":"trade","exch":7})", buffer) == StreamDecodeStatus::UNSUPPORTED);
+    REQUIRE(json::decodeStreamEvent(R"({"type":"quote","bid":1.0)", buffer) == StreamDecodeStatus::UNSUPPORTED);
+    REQUIRE(json::decodeStreamEvent(R"({"type":"quote"} trailing)", buffer) == StreamDecodeStatus::UNSUPPORTED);
+    REQUIRE(json::decodeStreamEvent("", buffer) == StreamDecodeStatus::UNSUPPORTED);
+}
+
+TEST_CASE("Stream Decoder - Compact events", "[streaming][json]") {
+    SymbolTable symbols;
+    json::CompactEventBuffer buffer;
+    
+    SECTION("Quote interns symbol and parses epoch dates") {
+        auto status = json::decodeCompactStreamEvent(
+            R"({"type":"quote","symbol":"AAPL","bid":149.9,"bidsz":10,"bidexch":"Q","biddate":"1640995200000",)"
+            R"("ask":"150.10","asksz":12,"askexch":"N","askdate":"1640995200123"})", symbols, buffer);
+        
+        REQUIRE(status == StreamDecodeStatus::QUOTE);
+        REQUIRE(symbols.name(buffer.quote.symbol) == "AAPL");
+        REQUIRE(buffer.quote.bid == 149.9);
+        REQUIRE(buffer.quote.ask == 150.10);
+        REQUIRE(buffer.quote.bidExchange == 'Q');
+        REQUIRE(buffer.quote.askExchange == 'N');
+        REQUIRE(buffer.quote.askTimeMs == 1640995200123);
+        REQUIRE(buffer.symbol == "AAPL");
+    }
+    
+    SECTION("Timesale session and flags") {
+        auto status = json::decodeCompactStreamEvent(
+            R"({"type":"timesale","symbol":"SPY","exch":"Q","last":"1.55","size":"200","date":"1640995200000",)"
+            R"("seq":42,"flag":"","cancel":false,"correction":true,"session":"post"})", symbols, buffer);
+        
+        REQUIRE(status == StreamDecodeStatus::TIMESALE);
+        REQUIRE(buffer.timesale.session == TradingSession::POST);
+        REQUIRE(buffer.timesale.flag == '\0');
+        REQUIRE(buffer.timesale.exchange == 'Q');
+        REQUIRE(buffer.timesale.correction);
+        REQUIRE(buffer.timesale.timestampMs == 1640995200000);
+    }
+    
+    SECTION("Symbols keep stable ids") {
+        json::decodeCompactStreamEvent(R"({"type":"trade","symbol":"SPY","price":1})", symbols, buffer);
+        SymbolId spy = buffer.trade.symbol;
+        json::decodeCompactStreamEvent(R"({"type":"trade","symbol":"QQQ","price":1})", symbols, buffer);
+        REQUIRE(buffer.trade.symbol != spy);
+        json::decodeCompactStreamEvent(R"({"type":"trade","symbol":"SPY","price":2})", symbols, buffer);
+        REQUIRE(buffer.trade.symbol == spy);
+        REQUIRE(symbols.size() == 2);
+        REQUIRE(symbols.find("QQQ").has_value());
+        REQUIRE_FALSE(symbols.find("IWM").has_value());
+    }
+    
+    SECTION("Summary is ignored, escapes fall back") {
+        REQUIRE(json::decodeCompactStreamEvent(R"({"type":"summary","symbol":"SPY"})", symbols, buffer)
+                == StreamDecodeStatus::IGNORED);
+        REQUIRE(json::decodeCompactStreamEvent(R"({"type":"trade","symbol":"A\"B"})", symbols, buffer)
+                == StreamDecodeStatus::UNSUPPORTED);
+    }
+}
@@ -0,0 +1,35 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+#include "tradier/common/async.hpp"
+#include "tradier/common/simple_async.hpp"
+
+using namespace tradier;
+using namespace std::chrono_literals;
+
+TEST_CASE("ThreadPool - Blocking calls do not starve the shared pool", "[threadpool]") {
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    
+    // More blocked calls than the shared pool has threads
+    std::vector<SimpleAsyncResult<int>> blocked;
+    size_t count = 2 * std::max(std::thread::hardware_concurrency(), 1u);
+    for (size_t i = 0; i < count; ++i) {
+        blocked.push_back(makeSimpleAsync<int>([released]() {
+            released.wait();
+            return ApiResult<int>(1);
+        }));
+    }
+    
+    auto decoded = ThreadPool::getInstance().enqueue([]() { return 42; });
+    auto status = decoded.wait_for(2s);
+    release.set_value();
+    REQUIRE(status == std::future_status::ready);
+    REQUIRE(decoded.get() == 42);
+    
+    for (auto& call : blocked) {
+        REQUIRE(call.get().value() == 1);
+    }
+}
\ No newline at end of file
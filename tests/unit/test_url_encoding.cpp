@@ -0,0 +1,32 @@
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <string>
+#include "tradier/common/utils.hpp"
+
+using namespace tradier;
+
+TEST_CASE("URL encoding - Unreserved characters pass through", "[urlencode]") {
+    REQUIRE(utils::urlEncode("AZaz09-_.~") == "AZaz09-_.~");
+    REQUIRE(utils::urlEncode("") == "");
+}
+
+TEST_CASE("URL encoding - Everything else is percent-encoded in upper case", "[urlencode]") {
+    REQUIRE(utils::urlEncode("AAPL,MSFT") == "AAPL%2CMSFT");
+    REQUIRE(utils::urlEncode("option[0][side]") == "option%5B0%5D%5Bside%5D");
+    REQUIRE(utils::urlEncode("a b&c=d+e/f") == "a%20b%26c%3Dd%2Be%2Ff");
+    REQUIRE(utils::urlEncode("\xC3\xA9") == "%C3%A9");
+    REQUIRE(utils::urlEncode(std::string("\0\xFF", 2)) == "%00%FF");
+}
+
+TEST_CASE("URL encoding - Params join into one query string", "[urlencode]") {
+    std::map<std::string, std::string> params = {
+        {"symbols", "SPY,QQQ"}, {"greeks", "true"}, {"option[0][quantity]", "1"}, {"tag", ""}};
+    
+    std::string query = "/markets/quotes?";
+    utils::appendUrlEncodedParams(query, params);
+    REQUIRE(query == "/markets/quotes?greeks=true&option%5B0%5D%5Bquantity%5D=1&symbols=SPY%2CQQQ&tag=");
+    
+    std::string body;
+    utils::appendUrlEncodedParams(body, std::map<std::string, std::string>{});
+    REQUIRE(body.empty());
+}